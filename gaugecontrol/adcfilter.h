@@ -0,0 +1,41 @@
+#ifndef ADCFILTER_H
+#define ADCFILTER_H
+
+#include <stdint.h>
+
+// Window filter applied to the decimated float sensor samples
+
+#define ADC_WINDOW_MAX 100           // Upper bound for numSamples
+#define ADC_FILTER_MEDIAN 0
+#define ADC_FILTER_TRIMMED_MEAN 1
+#define ADC_FILTER_MODE ADC_FILTER_TRIMMED_MEAN
+#define ADC_TRIM_PERCENT 20          // Share of the sorted window dropped at each end
+
+// Median or trimmed mean of count (1..ADC_WINDOW_MAX) samples, in raw ADC counts
+inline uint32_t filterAdcWindow(const uint16_t *samples, int count, int mode) {
+    uint16_t sorted[ADC_WINDOW_MAX];
+
+    // Insertion sort; the window is small
+    for (int i = 0; i < count; i++) {
+        uint16_t value = samples[i];
+        int j = i;
+        while (j > 0 && sorted[j - 1] > value) {
+            sorted[j] = sorted[j - 1];
+            j--;
+        }
+        sorted[j] = value;
+    }
+
+    if (mode == ADC_FILTER_MEDIAN) {
+        return sorted[count / 2];
+    }
+
+    int trim = (count * ADC_TRIM_PERCENT) / 100;
+    uint32_t total = 0;
+    for (int i = trim; i < count - trim; i++) {
+        total += sorted[i];
+    }
+    return total / (count - 2 * trim);
+}
+
+#endif
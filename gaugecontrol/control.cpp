@@ -0,0 +1,474 @@
+#include <math.h>
+#include "control.h"
+#include "hal.h"
+#include "metrics.h"
+
+Channel channels[MAX_CHANNELS];
+int channelCount = DEFAULT_CHANNEL_COUNT;
+
+// Variables that will be modified at runtime
+int blinkInterval = DEFAULT_BLINK_INTERVAL;
+int numSamples = DEFAULT_NUM_SAMPLES;
+int h2DebounceMs = DEFAULT_H2_DEBOUNCE_MS;
+int h2GlitchUs = DEFAULT_H2_GLITCH_US;
+
+// Double-buffered so a rebuild from the web task never tears the table the
+// control task is reading
+static SensorLutEntry sensorLut[MAX_CHANNELS][2][SENSOR_LUT_SIZE];
+static SensorLutEntry *volatile activeLut[MAX_CHANNELS];
+
+// Settings are handed over the same way; stepChannel() copies the active
+// buffer into Channel::settings at the start of every step
+static ChannelSettings settingsBuf[MAX_CHANNELS][2];
+static const ChannelSettings *volatile activeSettings[MAX_CHANNELS];
+
+// Set when new settings change the resistance -> duty mapping; the control
+// task then re-seeds the level estimator, whose level and drain rate were
+// learned in the old duty scale
+static volatile bool estimatorStale[MAX_CHANNELS];
+
+// Add these variables for watchdog timing
+unsigned long lastWatchdogTime = 0;
+bool watchdogEnabled = false;
+unsigned long bootTime = 0;
+
+// Per-step smoothing factors, rescaled to the control rate in controlBegin()
+float normalSmoothing = NORMAL_SMOOTHING;
+float recoverySmoothing = RECOVERY_SMOOTHING;
+
+// Single-writer seqlock per channel: the control task is the only writer,
+// readers on the other core retry until they see an even, unchanged
+// sequence number
+volatile uint32_t liveSeq[MAX_CHANNELS] = {};
+LiveData liveData[MAX_CHANNELS] = {};
+
+static void stepChannel(int ch);
+static void publishLiveData(int ch, const LiveData &live);
+static void logSample(int ch, uint32_t millivolts, const LiveData &live, bool h2_signal);
+static bool lowLevelCheck(int ch, int pwmDuty);
+
+static void rebuildTable(int ch, const ChannelSettings &settings);
+static float dividerOhms(int knownResistor, uint32_t millivolts);
+static bool sameDutyMapping(const ChannelSettings &a, const ChannelSettings &b);
+static int buildCurve(const ChannelSettings &settings, CalPoint *curve);
+static float curveDuty(const CalPoint *curve, int count, float ohms);
+
+void controlBegin() {
+    // Record boot time
+    bootTime = halMillis();
+
+    // Rescale the smoothing factors so the needle response does not depend on the control rate
+    normalSmoothing = 1.0 - pow(1.0 - NORMAL_SMOOTHING, (float)CONTROL_PERIOD_MS / SMOOTHING_REFERENCE_MS);
+    recoverySmoothing = 1.0 - pow(1.0 - RECOVERY_SMOOTHING, (float)CONTROL_PERIOD_MS / SMOOTHING_REFERENCE_MS);
+
+    for (int ch = 0; ch < MAX_CHANNELS; ch++) {
+        controlSetSettings(ch, channels[ch].settings);
+    }
+}
+
+void controlStep() {
+    uint32_t stepStart = halCycles();
+    metricsControlStepStart(stepStart);
+
+    // Handle watchdog signal
+    updateWatchdog();
+
+    // Channels share the control period round-robin, in a fixed order
+    for (int ch = 0; ch < channelCount; ch++) {
+        stepChannel(ch);
+    }
+
+    metricsRecord(METRIC_CONTROL_STEP, halCycles() - stepStart);
+}
+
+static void stepChannel(int ch) {
+    Channel &c = channels[ch];
+    c.settings = *activeSettings[ch];  // Snapshot, held for the whole step
+    const ChannelSettings &s = c.settings;
+
+    uint32_t stepStart = halCycles();
+
+    // The edge interrupt has already set the PS output to 0 on an H2 drop;
+    // bring the PEM state in line and record how long the cutoff took
+    uint32_t isrCycles;
+    if (halTakeH2Cutoff(ch, &isrCycles)) {
+        metricsRecord(METRIC_H2_ISR, isrCycles);
+        c.logEvents |= LOG_EVENT_H2_CUTOFF;
+        if (c.pemState != PEM_IDLE) {
+            stopPEM(ch);
+        }
+    }
+
+    // Until the sampler's first frame the level is unknown: no estimate, no
+    // gauge output and no PEM start. The estimator then seeds from the
+    // first real reading instead of from 0 mV (an empty tank).
+    if (!halSensorReady(ch)) {
+        return;
+    }
+
+    // Check H2 signal (debounced)
+    bool h2_signal = halReadH2Signal(ch);
+
+    // Handle PEM start/stop based on H2 signal
+    if (h2_signal && c.pemState == PEM_IDLE && !c.lowLevelLockout) {
+        startPEM(ch);
+    } else if (!h2_signal && c.pemState != PEM_IDLE) {
+        stopPEM(ch);
+    }
+
+    // Advance the soft-start ramp without blocking
+    updatePEM(ch);
+    uint32_t t = halCycles();
+    metricsRecord(METRIC_PEM, t - stepStart);
+
+    // Read float sensor resistance
+    uint32_t millivolts = halReadSensorMillivolts(ch);
+    uint32_t now = halCycles();
+    metricsRecord(METRIC_ADC_READ, now - t);
+    t = now;
+
+    if (estimatorStale[ch]) {
+        estimatorStale[ch] = false;
+        estimatorReset(c.levelEstimator);
+    }
+
+    // Resistance and gauge duty from the calibration table
+    SensorLutEntry reading = sensorLookup(ch, millivolts);
+    float resistance = reading.ohmsQ4 / 16.0;
+    int targetDuty = (reading.dutyQ8 + 128) >> 8;
+    now = halCycles();
+    metricsRecord(METRIC_RESISTANCE, now - t);
+    t = now;
+
+    // Level and drain rate estimate, driven by what the power supply is drawing
+    float drive = c.rampValue / 255.0f;
+    estimatorUpdate(c.levelEstimator, reading.dutyQ8 / 256.0f, drive, CONTROL_PERIOD_MS / 1000.0f,
+                    s.levelNoise, s.rateNoise);
+
+    if (s.levelFilter == LEVEL_FILTER_KALMAN) {
+        c.smoothedDuty = c.levelEstimator.level;
+    } else {
+        // Use faster recovery when coming back from low level
+        float smoothingFactor = (c.wasInLowLevel && targetDuty > BLINK_THRESHOLD) ?
+                                recoverySmoothing : normalSmoothing;
+
+        // Smooth gauge movement with adaptive smoothing
+        c.smoothedDuty = (smoothingFactor * (reading.dutyQ8 / 256.0f)) + ((1.0f - smoothingFactor) * c.smoothedDuty);
+    }
+    now = halCycles();
+    metricsRecord(METRIC_SMOOTHING, now - t);
+    t = now;
+
+    // Apply smoothed PWM duty cycle to gauge
+    halSetGaugeDuty(ch, (int)c.smoothedDuty);
+    metricsBootMilestone(BOOT_FIRST_ACTUATION);
+    now = halCycles();
+    metricsRecord(METRIC_GAUGE_UPDATE, now - t);
+    t = now;
+
+    // Track if we are/were in low level state
+    bool isInLowLevel = ((int)c.smoothedDuty < BLINK_THRESHOLD);
+    c.wasInLowLevel = isInLowLevel;
+
+    // Handle low fill level conditions
+    manageSafety(ch, (int)c.smoothedDuty);
+    now = halCycles();
+    metricsRecord(METRIC_SAFETY, now - t);
+
+    // Store for web interface and telemetry
+    LiveData live;
+    live.resistance = resistance;
+    live.targetDuty = targetDuty;
+    live.smoothedDuty = (int)c.smoothedDuty;
+    live.rampValue = c.rampValue;
+    live.pemRunning = (c.pemState != PEM_IDLE);
+    live.levelRate = c.levelEstimator.rate * c.rampValue / 255.0f;
+    live.timeToEmpty = estimatorTimeToLevel(c.levelEstimator, c.rampValue / 255.0f, s.lowLevelThreshold);
+    publishLiveData(ch, live);
+
+    // Record every LOG_DECIMATION steps, and straight away on a PEM/safety event
+    if (++c.logDivider >= LOG_DECIMATION || c.logEvents != 0) {
+        c.logDivider = 0;
+        logSample(ch, millivolts, live, h2_signal);
+    }
+}
+
+static void publishLiveData(int ch, const LiveData &live) {
+    liveSeq[ch] = liveSeq[ch] + 1;  // Odd: update in progress
+    __sync_synchronize();
+    liveData[ch] = live;
+    __sync_synchronize();
+    liveSeq[ch] = liveSeq[ch] + 1;
+}
+
+static void logSample(int ch, uint32_t millivolts, const LiveData &live, bool h2_signal) {
+    Channel &c = channels[ch];
+    LogRecord record;
+    record.timeMs = halMillis();
+    record.resistance = live.resistance;
+    record.millivolts = millivolts > 0xFFFF ? 0xFFFF : millivolts;
+    record.targetDuty = live.targetDuty;
+    record.smoothedDuty = live.smoothedDuty < 0 ? 0 : (live.smoothedDuty > 255 ? 255 : live.smoothedDuty);
+    record.psDuty = c.rampValue;
+    record.flags = (h2_signal ? LOG_FLAG_H2 : 0) |
+                   (live.pemRunning ? LOG_FLAG_PEM_ACTIVE : 0) |
+                   (c.lowLevelLockout ? LOG_FLAG_LOW_LEVEL : 0) |
+                   (ch << LOG_FLAG_CHANNEL_SHIFT);
+    record.events = c.logEvents;
+    c.logEvents = 0;
+    halLogRecord(record);
+}
+
+LiveData readLiveData(int ch) {
+    LiveData live;
+    uint32_t seq;
+    do {
+        seq = liveSeq[ch];
+        __sync_synchronize();
+        live = liveData[ch];
+        __sync_synchronize();
+    } while ((seq & 1) || seq != liveSeq[ch]);
+    return live;
+}
+
+void startPEM(int ch) {
+    Channel &c = channels[ch];
+    halSetPsDuty(ch, 0);
+    c.pemState = PEM_RAMPING;
+    c.rampValue = 0;
+    c.logEvents |= LOG_EVENT_PEM_START;
+    c.lastRampStepTime = halMillis();
+
+    halLog("Starting PEM - Ramping power supply");
+}
+
+// Step the soft-start ramp. Called once per control step; never blocks and
+// takes at most MAX_RAMP_STEPS_PER_PASS steps, so an H2 drop or low level
+// is acted on by the next step.
+void updatePEM(int ch) {
+    Channel &c = channels[ch];
+    const ChannelSettings &s = c.settings;
+    if (c.pemState != PEM_RAMPING) return;
+
+    unsigned long currentMillis = halMillis();
+    int steps = 0;
+
+    while (currentMillis - c.lastRampStepTime >= (unsigned long)s.stepDelayMs &&
+           steps < MAX_RAMP_STEPS_PER_PASS) {
+        c.lastRampStepTime += s.stepDelayMs;
+        steps++;
+
+        c.rampValue += s.pemStepSize;
+        // Ensure we reach exactly the max value
+        if (c.rampValue >= s.pemMaxValue) {
+            c.rampValue = s.pemMaxValue;
+            c.pemState = PEM_RUNNING;
+            c.logEvents |= LOG_EVENT_PEM_RUNNING;
+            break;
+        }
+    }
+
+    // If the control task fell far behind, resume from now instead of bursting
+    if (c.pemState == PEM_RAMPING && currentMillis - c.lastRampStepTime >= (unsigned long)s.stepDelayMs) {
+        c.lastRampStepTime = currentMillis;
+    }
+
+    if (steps > 0) {
+        halSetPsDuty(ch, c.rampValue);
+    }
+}
+
+void stopPEM(int ch) {
+    Channel &c = channels[ch];
+
+    // Immediately set power supply control to 0, before anything else
+    halSetPsDuty(ch, 0);
+    c.pemState = PEM_IDLE;
+    c.rampValue = 0;
+    c.logEvents |= LOG_EVENT_PEM_STOP;
+
+    halLog("Stopping PEM");
+}
+
+float resistanceFromMillivolts(int ch, uint32_t millivolts) {
+    return dividerOhms(channels[ch].settings.knownResistor, millivolts);
+}
+
+static float dividerOhms(int knownResistor, uint32_t millivolts) {
+    float voltage = millivolts / 1000.0;
+
+    if (voltage <= 0.1) return MAX_RESISTANCE;  // Default to empty if sensor fails
+
+    // Use Ohm's law: R_sensor = (V / (3.3 - V)) * Known_Resistor
+    float resistance = (voltage / (3.3 - voltage)) * knownResistor;
+    return resistance;
+}
+
+void controlSetSettings(int ch, const ChannelSettings &settings) {
+    const ChannelSettings *prev = activeSettings[ch];
+    ChannelSettings *next = (prev == &settingsBuf[ch][0]) ? &settingsBuf[ch][1] : &settingsBuf[ch][0];
+    *next = settings;
+    rebuildTable(ch, *next);
+
+    __sync_synchronize();
+    activeSettings[ch] = next;
+    if (prev && !sameDutyMapping(*prev, *next)) {
+        estimatorStale[ch] = true;
+    }
+}
+
+static bool sameDutyMapping(const ChannelSettings &a, const ChannelSettings &b) {
+    if (a.knownResistor != b.knownResistor ||
+        a.maxResistance != b.maxResistance || a.minResistance != b.minResistance ||
+        a.minDuty != b.minDuty || a.maxDuty != b.maxDuty ||
+        a.calibrationCount != b.calibrationCount) {
+        return false;
+    }
+    for (int i = 0; i < a.calibrationCount && i < CAL_MAX_POINTS; i++) {
+        if (a.calibration[i].resistance != b.calibration[i].resistance ||
+            a.calibration[i].duty != b.calibration[i].duty) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void rebuildTable(int ch, const ChannelSettings &settings) {
+    CalPoint curve[CAL_MAX_POINTS];
+    int count = buildCurve(settings, curve);
+
+    SensorLutEntry *lut = (activeLut[ch] == sensorLut[ch][0]) ? sensorLut[ch][1] : sensorLut[ch][0];
+    for (int i = 0; i < SENSOR_LUT_SIZE; i++) {
+        float ohms = dividerOhms(settings.knownResistor, i << SENSOR_LUT_MV_SHIFT);
+        // Above the supply voltage the divider formula goes negative: treat as an open sender
+        if (!(ohms >= 0) || ohms > SENSOR_LUT_MAX_OHMS) ohms = SENSOR_LUT_MAX_OHMS;
+
+        float duty = curveDuty(curve, count, ohms);
+        if (duty < 0) duty = 0;
+        if (duty > 255) duty = 255;
+
+        lut[i].ohmsQ4 = (uint16_t)(ohms * 16 + 0.5);
+        lut[i].dutyQ8 = (uint16_t)(duty * 256 + 0.5);
+    }
+
+    __sync_synchronize();
+    activeLut[ch] = lut;
+}
+
+SensorLutEntry sensorLookup(int ch, uint32_t millivolts) {
+    const SensorLutEntry *lut = activeLut[ch];
+    uint32_t index = millivolts >> SENSOR_LUT_MV_SHIFT;
+    if (index >= SENSOR_LUT_SIZE - 1) return lut[SENSOR_LUT_SIZE - 1];
+
+    // Linear interpolation between neighbouring entries
+    int32_t frac = millivolts & ((1 << SENSOR_LUT_MV_SHIFT) - 1);
+    const SensorLutEntry &a = lut[index];
+    const SensorLutEntry &b = lut[index + 1];
+    SensorLutEntry entry;
+    entry.ohmsQ4 = a.ohmsQ4 + ((((int32_t)b.ohmsQ4 - a.ohmsQ4) * frac) >> SENSOR_LUT_MV_SHIFT);
+    entry.dutyQ8 = a.dutyQ8 + ((((int32_t)b.dutyQ8 - a.dutyQ8) * frac) >> SENSOR_LUT_MV_SHIFT);
+    return entry;
+}
+
+// Active curve sorted by resistance; the linear min/max range unless a user curve is set
+static int buildCurve(const ChannelSettings &settings, CalPoint *curve) {
+    int count = 0;
+    if (settings.calibrationCount >= 2) {
+        for (int i = 0; i < settings.calibrationCount && i < CAL_MAX_POINTS; i++) {
+            // Insertion sort, at most CAL_MAX_POINTS entries
+            int j = count++;
+            while (j > 0 && curve[j - 1].resistance > settings.calibration[i].resistance) {
+                curve[j] = curve[j - 1];
+                j--;
+            }
+            curve[j] = settings.calibration[i];
+        }
+    } else {
+        curve[count++] = {(float)settings.minResistance, settings.maxDuty};
+        curve[count++] = {(float)settings.maxResistance, settings.minDuty};
+    }
+    return count;
+}
+
+// Piecewise-linear duty at a resistance; the end segments extend past the curve
+static float curveDuty(const CalPoint *curve, int count, float ohms) {
+    int i = 1;
+    while (i < count - 1 && ohms > curve[i].resistance) i++;
+
+    const CalPoint &a = curve[i - 1];
+    const CalPoint &b = curve[i];
+    if (b.resistance == a.resistance) return b.duty;
+    return a.duty + (ohms - a.resistance) * (b.duty - a.duty) / (b.resistance - a.resistance);
+}
+
+// Function to manage low-level conditions
+void manageSafety(int ch, int pwmDuty) {
+    Channel &c = channels[ch];
+    unsigned long currentMillis = halMillis();
+
+    // Blink Backlight if below threshold
+    if (pwmDuty < c.settings.blinkThreshold) {
+        if (currentMillis - c.lastBlinkTime >= (unsigned long)blinkInterval) {
+            c.lastBlinkTime = currentMillis;
+            c.blinkState = !c.blinkState;
+            halSetBacklight(ch, c.blinkState);
+        }
+    } else {
+        // Reset blinking state and set backlight HIGH when above threshold
+        c.blinkState = false;
+        halSetBacklight(ch, true);
+    }
+
+    // If level is too low, shut down power supply by setting control voltage to 0.
+    // This also aborts a ramp in progress; startPEM() stays locked out until the level recovers.
+    c.lowLevelLockout = lowLevelCheck(ch, pwmDuty);
+    if (c.lowLevelLockout) {
+        bool wasRunning = (c.pemState != PEM_IDLE);
+        halSetPsDuty(ch, 0);
+        c.pemState = PEM_IDLE;
+        c.rampValue = 0;
+        if (wasRunning) {
+            c.logEvents |= LOG_EVENT_LOW_LEVEL_TRIP;
+            halLog("Low level detected! Shutting down power supply.");
+        }
+    }
+}
+
+// Legacy filter: the smoothed duty against the threshold. Estimator: trip when
+// the level is predicted to cross the threshold within lowLevelLookahead
+// seconds at the current drain, and re-arm only once the level, with the
+// drain a restart would bring, is LOW_LEVEL_HYSTERESIS above it.
+static bool lowLevelCheck(int ch, int pwmDuty) {
+    const Channel &c = channels[ch];
+    const ChannelSettings &s = c.settings;
+    if (s.levelFilter != LEVEL_FILTER_KALMAN) {
+        return pwmDuty < s.lowLevelThreshold;
+    }
+
+    float drive = c.rampValue / 255.0f;
+    if (!c.lowLevelLockout) {
+        float predicted = c.levelEstimator.level + c.levelEstimator.rate * drive * s.lowLevelLookahead;
+        return predicted < s.lowLevelThreshold;
+    }
+    float restartDrive = s.pemMaxValue / 255.0f;
+    float predicted = c.levelEstimator.level + c.levelEstimator.rate * restartDrive * s.lowLevelLookahead;
+    return predicted < s.lowLevelThreshold + LOW_LEVEL_HYSTERESIS;
+}
+
+// Update the watchdog function
+void updateWatchdog() {
+    unsigned long currentMillis = halMillis();
+
+    // Only enable watchdog after a safe boot period
+    if (!watchdogEnabled && (currentMillis - bootTime > WATCHDOG_ENABLE_DELAY)) {
+        watchdogEnabled = true;
+        halLog("Watchdog activated");
+    }
+
+    // Simply toggle the watchdog pin at the required interval
+    if (watchdogEnabled && (currentMillis - lastWatchdogTime >= WATCHDOG_INTERVAL)) {
+        lastWatchdogTime = currentMillis;
+        halToggleWatchdog();
+        metricsWatchdogToggle(currentMillis);
+    }
+}
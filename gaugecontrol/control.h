@@ -0,0 +1,180 @@
+#ifndef CONTROL_H
+#define CONTROL_H
+
+#include <stdint.h>
+#include "datalog.h"
+#include "levelestimator.h"
+
+// Gauge, PEM soft-start and safety logic. Only talks to hardware through
+// hal.h so it builds for the board and for the host simulation.
+
+// Float Sensor Resistance Range
+#define MAX_RESISTANCE 240  // Ohms (Empty Tank)
+#define MIN_RESISTANCE 30   // Ohms (Full Tank)
+#define KNOWN_RESISTOR 100  // Changed from 10000 to 100 ohms
+
+// PWM Range for Gauge
+#define MIN_DUTY 140         // Empty
+#define MAX_DUTY 255         // Full
+#define BLINK_THRESHOLD 10  // If PWM < 150, blink BACKLIGHT_PIN
+#define LOW_LEVEL_THRESHOLD 145  // Cut power if below this
+#define LOW_LEVEL_HYSTERESIS 3   // Estimated level must recover this far above the threshold to re-arm
+
+#define BLINK_INTERVAL 250   // Blink time in milliseconds
+#define NUM_SAMPLES 10       // Number of filtered ADC samples in the noise filter window
+#define STEP_DELAY_MS 20     // Delay between power ramp steps (ms)
+
+#define WATCHDOG_INTERVAL 10   // 10ms interval
+#define WATCHDOG_ENABLE_DELAY 5000 // 5 seconds delay before enabling watchdog
+
+// Increased smoothing factor for faster response
+#define NORMAL_SMOOTHING 0.05  // Regular smoothing (5% of new value)
+#define RECOVERY_SMOOTHING 0.25 // Faster smoothing when recovering from low level (25% of new value)
+#define SMOOTHING_REFERENCE_MS 50 // Step period the smoothing factors above were tuned at
+
+#define CONTROL_RATE_HZ 200          // Sampling/actuation rate of the control task
+#define CONTROL_PERIOD_MS (1000 / CONTROL_RATE_HZ)
+
+#define MAX_RAMP_STEPS_PER_PASS 4  // Catch-up steps allowed in one control step
+
+// H2 input filtering, done by the edge interrupt in the HAL. H2 counts as on
+// once the input has been high for h2DebounceMs; an off edge cuts the power
+// supply from the interrupt once the input has stayed low for h2GlitchUs.
+#define DEFAULT_H2_DEBOUNCE_MS 50
+#define DEFAULT_H2_GLITCH_US 20
+#define H2_DEBOUNCE_MAX_MS 1000
+#define H2_GLITCH_MAX_US 100         // The interrupt busy-waits this long at most
+
+// Sensor voltage -> resistance/duty lookup table, one entry per 4 mV
+#define SENSOR_LUT_MV_SHIFT 2
+#define SENSOR_LUT_MAX_MV 3300
+#define SENSOR_LUT_SIZE ((SENSOR_LUT_MAX_MV >> SENSOR_LUT_MV_SHIFT) + 2)
+#define SENSOR_LUT_MAX_OHMS 4095     // Open sender / divider saturated
+
+#define CAL_MAX_POINTS 8             // Points in a user calibration curve
+
+#define MAX_CHANNELS 3               // Tank/gauge/PS channels; limited by the pin map in hal.h
+#define DEFAULT_CHANNEL_COUNT 1
+
+// Replace fixed #define values with variables
+// Keep the #define for default values
+#define DEFAULT_MAX_RESISTANCE 240
+#define DEFAULT_MIN_RESISTANCE 30
+#define DEFAULT_KNOWN_RESISTOR 100
+#define DEFAULT_MIN_DUTY 140
+#define DEFAULT_MAX_DUTY 255
+#define DEFAULT_BLINK_THRESHOLD 10
+#define DEFAULT_LOW_LEVEL_THRESHOLD 145
+#define DEFAULT_BLINK_INTERVAL 250
+#define DEFAULT_NUM_SAMPLES 10
+#define DEFAULT_STEP_DELAY_MS 20
+
+// Add default values
+#define DEFAULT_PEM_MAX_VALUE 255
+#define DEFAULT_PEM_STEP_SIZE 1
+
+// PEM soft-start state machine, advanced a bounded slice per control step
+enum PemState {
+  PEM_IDLE,     // Power supply held at 0
+  PEM_RAMPING,  // Stepping towards pemMaxValue every stepDelayMs
+  PEM_RUNNING   // Holding pemMaxValue
+};
+
+// One point of the sender-resistance -> gauge-duty calibration curve
+struct CalPoint {
+  float resistance;  // Ohms
+  int duty;          // Gauge duty (0-255) wanted at that resistance
+};
+
+// Settings of one tank/gauge/PS channel. Also the per-channel part of the
+// stored config blob: any change to it moves the channels that follow, so
+// it needs a CONFIG_VERSION bump and a migration like any other layout change.
+struct ChannelSettings {
+  int maxResistance = DEFAULT_MAX_RESISTANCE;
+  int minResistance = DEFAULT_MIN_RESISTANCE;
+  int knownResistor = DEFAULT_KNOWN_RESISTOR;
+  int minDuty = DEFAULT_MIN_DUTY;
+  int maxDuty = DEFAULT_MAX_DUTY;
+  int blinkThreshold = DEFAULT_BLINK_THRESHOLD;
+  int lowLevelThreshold = DEFAULT_LOW_LEVEL_THRESHOLD;
+  int stepDelayMs = DEFAULT_STEP_DELAY_MS;
+  int pemMaxValue = DEFAULT_PEM_MAX_VALUE;
+  int pemStepSize = DEFAULT_PEM_STEP_SIZE;
+  // User curve, any order. With fewer than 2 points the gauge is a straight
+  // line from (maxResistance, minDuty) to (minResistance, maxDuty).
+  CalPoint calibration[CAL_MAX_POINTS] = {};
+  int calibrationCount = 0;
+  int levelFilter = DEFAULT_LEVEL_FILTER;  // LEVEL_FILTER_EMA or LEVEL_FILTER_KALMAN
+  float levelNoise = DEFAULT_LEVEL_NOISE;
+  float rateNoise = DEFAULT_RATE_NOISE;
+  int lowLevelLookahead = DEFAULT_LOW_LEVEL_LOOKAHEAD;
+};
+
+// Runtime state of one channel, owned by the control task
+struct Channel {
+  ChannelSettings settings;          // Copy of the handed-over settings, taken each step
+  float smoothedDuty = MIN_DUTY;     // Start at lowest gauge position
+  PemState pemState = PEM_IDLE;
+  int rampValue = 0;
+  unsigned long lastRampStepTime = 0;
+  bool lowLevelLockout = false;      // Set by manageSafety() while level is below lowLevelThreshold
+  bool wasInLowLevel = false;        // Track if we were previously in low level
+  LevelEstimator levelEstimator = {};
+  unsigned long lastBlinkTime = 0;
+  bool blinkState = false;
+  uint8_t logEvents = LOG_EVENT_BOOT;  // Data log events since the last record
+  int logDivider = 0;
+};
+
+// Lookup table entry in fixed point
+struct SensorLutEntry {
+  uint16_t ohmsQ4;   // Resistance in 1/16 ohm
+  uint16_t dutyQ8;   // Gauge duty in 1/256 steps
+};
+
+extern Channel channels[MAX_CHANNELS];
+extern int channelCount;             // Channels in use (1..MAX_CHANNELS), fixed after halBegin()
+
+// Variables shared by all channels
+extern int blinkInterval;
+extern int numSamples;
+extern int h2DebounceMs;
+extern int h2GlitchUs;
+
+// Values published by the control task for the web interface and telemetry
+struct LiveData {
+  float resistance;
+  int targetDuty;
+  int smoothedDuty;
+  int rampValue;
+  bool pemRunning;
+  float levelRate;    // Estimated level change, duty/s (negative while draining)
+  float timeToEmpty;  // Seconds until lowLevelThreshold at that rate, -1 if not draining
+};
+
+// Record boot time and derive per-step constants; call once before controlStep()
+void controlBegin();
+
+// One sample/actuate pass over every channel in turn, run every CONTROL_PERIOD_MS
+void controlStep();
+
+void startPEM(int ch);
+void updatePEM(int ch);
+void stopPEM(int ch);
+float resistanceFromMillivolts(int ch, uint32_t millivolts);
+
+// Hand new settings to a channel and rebuild its lookup table from
+// knownResistor, the duty/resistance range and the calibration curve. Safe
+// while controlStep() runs; the control task uses them from its next step,
+// and re-seeds the level estimator if the duty mapping changed.
+void controlSetSettings(int ch, const ChannelSettings &settings);
+
+// Interpolated table entry for a filtered sensor voltage
+SensorLutEntry sensorLookup(int ch, uint32_t millivolts);
+void manageSafety(int ch, int pwmDuty);
+void updateWatchdog();
+
+// Safe to call from any task
+LiveData readLiveData(int ch);
+
+#endif
@@ -0,0 +1,59 @@
+#ifndef DATALOG_H
+#define DATALOG_H
+
+#include <stdint.h>
+
+// Binary sample log. The control task queues one LogRecord every
+// LOG_DECIMATION steps (and immediately on a PEM/safety event); the logger
+// task packs them into LOG_PAGE_SIZE pages written round-robin, one flash
+// sector each, at the start of a data partition. tools/logdecode.cpp converts a /log download
+// to CSV, and gaugesim --log writes the same format on the host.
+
+#define LOG_DECIMATION 4             // Control steps per logged sample (50 Hz at 200 Hz)
+#define LOG_PAGE_SIZE 4096           // One flash sector per page write
+#define LOG_PAGE_COUNT 192           // 768 KB ring, ~16 minutes at 50 Hz
+#define LOG_PAGE_MAGIC 0x474F4C47    // "GLOG"
+#define LOG_FORMAT_VERSION 1
+
+// flags
+#define LOG_FLAG_H2 0x01             // H2 signal present
+#define LOG_FLAG_PEM_ACTIVE 0x02     // PEM ramping or running
+#define LOG_FLAG_LOW_LEVEL 0x04      // Low-level lockout active
+#define LOG_FLAG_CHANNEL_SHIFT 6     // Top two bits: channel the record belongs to
+#define LOG_FLAG_CHANNEL_MASK 0xC0
+
+// events (bitmask, set on the record of the step where they happened)
+#define LOG_EVENT_PEM_START 0x01
+#define LOG_EVENT_PEM_RUNNING 0x02   // Ramp reached pemMaxValue
+#define LOG_EVENT_PEM_STOP 0x04      // H2 dropped
+#define LOG_EVENT_LOW_LEVEL_TRIP 0x08
+#define LOG_EVENT_BOOT 0x10          // First record after power-up
+#define LOG_EVENT_H2_CUTOFF 0x20     // H2 edge interrupt cut the PS output
+
+// 16 bytes, little-endian
+struct LogRecord {
+  uint32_t timeMs;
+  float resistance;
+  uint16_t millivolts;     // Filtered sensor voltage the step used
+  int16_t targetDuty;
+  uint8_t smoothedDuty;
+  uint8_t psDuty;
+  uint8_t flags;
+  uint8_t events;
+};
+static_assert(sizeof(LogRecord) == 16, "LogRecord is part of the on-flash format");
+
+// Header at the start of every page; pages are ordered by sequence
+struct LogPageHeader {
+  uint32_t magic;
+  uint32_t sequence;
+  uint16_t version;
+  uint16_t recordSize;
+  uint16_t recordCount;    // Valid records following the header
+  uint16_t reserved;
+};
+static_assert(sizeof(LogPageHeader) == 16, "LogPageHeader is part of the on-flash format");
+
+#define LOG_RECORDS_PER_PAGE ((LOG_PAGE_SIZE - sizeof(LogPageHeader)) / sizeof(LogRecord))
+
+#endif
@@ -0,0 +1,198 @@
+#include <Arduino.h>
+#include <esp_partition.h>
+#include "datalog.h"
+#include "datalog_esp32.h"
+#include "hal.h"
+#include "metrics.h"
+
+// Flash ring logger. The control task only ever does a non-blocking queue
+// send; logTask owns the partition and does all flash I/O on the PRO core.
+// The ring sits directly in a data partition, one flash sector per page, so
+// a page write is exactly one sector erase plus one sector program. (A file
+// system would copy-on-write the rest of the file on every in-place page
+// write.) Reads go through a read-only memory mapping.
+// Running on the other core does not isolate the control task from it:
+// every flash write or erase turns the cache off and parks the other core,
+// so the control step pauses for the length of each page write. Only IRAM
+// interrupts (the H2 cutoff) keep running. Page writes are therefore kept
+// rare and each one is timed as METRIC_LOG_WRITE.
+
+#define LOG_PARTITION_LABEL "spiffs"  // Data partition of the default scheme, used whole by the log
+#define LOG_RING_SIZE ((size_t)LOG_PAGE_SIZE * LOG_PAGE_COUNT)
+#define LOG_QUEUE_LENGTH 64          // Records buffered while a page write is in progress
+#define LOG_TASK_CORE 0
+#define LOG_TASK_PRIORITY 1
+#define LOG_TASK_STACK 4096
+#define LOG_EVENT_FLUSH_MS 1000      // Partial pages holding an event are written at most this often
+
+struct LogPage {
+  LogPageHeader header;
+  LogRecord records[LOG_RECORDS_PER_PAGE];
+};
+static_assert(sizeof(LogPage) == LOG_PAGE_SIZE, "A log page must fill one flash sector");
+
+static QueueHandle_t logQueue = NULL;
+static TaskHandle_t logTaskHandle = NULL;
+static const esp_partition_t *logPartition = NULL;
+static const uint8_t *logMap = NULL;          // Ring mapped read-only into the data address space
+static spi_flash_mmap_handle_t logMapHandle;
+static LogPage page;                          // Page being filled, written at writePage
+static volatile uint16_t writePage = 0;
+static volatile bool logReady = false;
+static volatile uint32_t droppedRecords = 0;
+static volatile uint32_t pagesWritten = 0;
+static volatile uint32_t writeErrors = 0;
+
+static void logTask(void *param);
+static bool openLogPartition();
+static void startPage(uint16_t index, uint32_t sequence);
+static void writeCurrentPage();
+
+void dataLogBegin() {
+    logQueue = xQueueCreate(LOG_QUEUE_LENGTH, sizeof(LogRecord));
+    xTaskCreatePinnedToCore(logTask, "datalog", LOG_TASK_STACK, NULL,
+                            LOG_TASK_PRIORITY, &logTaskHandle, LOG_TASK_CORE);
+}
+
+bool dataLogPush(const LogRecord &record) {
+    if (logQueue == NULL || xQueueSend(logQueue, &record, 0) != pdTRUE) {
+        droppedRecords = droppedRecords + 1;
+        return false;
+    }
+    return true;
+}
+
+uint16_t dataLogOldestPage() {
+    return (writePage + 1) % LOG_PAGE_COUNT;
+}
+
+size_t dataLogSize() {
+    return logReady ? LOG_RING_SIZE : 0;
+}
+
+// Copy part of the log, oldest page first, straight into the response buffer
+size_t dataLogRead(uint16_t firstPage, size_t index, uint8_t *buffer, size_t maxLen) {
+    if (!logReady || index >= LOG_RING_SIZE) return 0;
+
+    size_t pageIndex = (firstPage + index / LOG_PAGE_SIZE) % LOG_PAGE_COUNT;
+    size_t offset = index % LOG_PAGE_SIZE;
+    size_t length = min(maxLen, (size_t)LOG_PAGE_SIZE - offset);
+
+    memcpy(buffer, logMap + pageIndex * LOG_PAGE_SIZE + offset, length);
+    return length;
+}
+
+uint32_t dataLogDropped() {
+    return droppedRecords;
+}
+
+uint32_t dataLogPagesWritten() {
+    return pagesWritten;
+}
+
+uint32_t dataLogWriteErrors() {
+    return writeErrors;
+}
+
+// Find and map the partition, then drain the queue into pages.
+// A page is written when it fills. A page holding an event is also written
+// early, but no sooner than LOG_EVENT_FLUSH_MS after the previous write, so
+// a trip reaches flash within about a second and a burst of events costs
+// one page write, not one per event.
+static void logTask(void *param) {
+    if (!openLogPartition()) {
+        Serial.println("Data log unavailable");
+        vTaskDelete(NULL);
+    }
+    logReady = true;
+
+    bool eventPending = false;
+    unsigned long lastWriteMs = millis();
+
+    for (;;) {
+        TickType_t wait = portMAX_DELAY;
+        if (eventPending) {
+            unsigned long elapsed = millis() - lastWriteMs;
+            wait = elapsed >= LOG_EVENT_FLUSH_MS ? 0 : pdMS_TO_TICKS(LOG_EVENT_FLUSH_MS - elapsed);
+        }
+
+        LogRecord record;
+        bool full = false;
+        if (xQueueReceive(logQueue, &record, wait) == pdTRUE) {
+            page.records[page.header.recordCount++] = record;
+            full = (page.header.recordCount == LOG_RECORDS_PER_PAGE);
+            if (record.events != 0) eventPending = true;
+        }
+
+        if (full || (eventPending && millis() - lastWriteMs >= LOG_EVENT_FLUSH_MS)) {
+            writeCurrentPage();
+            lastWriteMs = millis();
+            eventPending = false;
+        }
+        if (full) {
+            startPage((writePage + 1) % LOG_PAGE_COUNT, page.header.sequence + 1);
+        }
+    }
+}
+
+static bool openLogPartition() {
+    logPartition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY,
+                                            LOG_PARTITION_LABEL);
+    if (logPartition == NULL || logPartition->size < LOG_RING_SIZE) {
+        Serial.println("No \"" LOG_PARTITION_LABEL "\" partition of at least 768 KB");
+        return false;
+    }
+    const void *mapped;
+    if (esp_partition_mmap(logPartition, 0, LOG_RING_SIZE, SPI_FLASH_MMAP_DATA,
+                           &mapped, &logMapHandle) != ESP_OK) {
+        return false;
+    }
+    logMap = (const uint8_t *)mapped;
+
+    // Resume after the page with the highest sequence number. Sectors that
+    // never held a log page (erased, or left over from a file system) are
+    // skipped by the magic/version check.
+    uint32_t lastSequence = 0;
+    int lastPage = -1;
+    for (int i = 0; i < LOG_PAGE_COUNT; i++) {
+        const LogPageHeader *header = (const LogPageHeader *)(logMap + (size_t)i * LOG_PAGE_SIZE);
+        if (header->magic == LOG_PAGE_MAGIC && header->version == LOG_FORMAT_VERSION &&
+            (lastPage < 0 || header->sequence > lastSequence)) {
+            lastSequence = header->sequence;
+            lastPage = i;
+        }
+    }
+
+    startPage((lastPage + 1) % LOG_PAGE_COUNT, lastSequence + 1);
+    Serial.print("Data log resuming at page ");
+    Serial.println(writePage);
+    return true;
+}
+
+static void startPage(uint16_t index, uint32_t sequence) {
+    memset(&page, 0xFF, sizeof(page));
+    page.header.magic = LOG_PAGE_MAGIC;
+    page.header.sequence = sequence;
+    page.header.version = LOG_FORMAT_VERSION;
+    page.header.recordSize = sizeof(LogRecord);
+    page.header.recordCount = 0;
+    page.header.reserved = 0;
+    writePage = index;
+}
+
+// One sector erase and program. A failed page is counted and left for the
+// next write of the same page (or the next lap of the ring) to replace.
+static void writeCurrentPage() {
+    size_t offset = (size_t)writePage * LOG_PAGE_SIZE;
+    uint32_t start = halCycles();
+    esp_err_t err = esp_partition_erase_range(logPartition, offset, LOG_PAGE_SIZE);
+    if (err == ESP_OK) {
+        err = esp_partition_write(logPartition, offset, &page, sizeof(page));
+    }
+    metricsRecord(METRIC_LOG_WRITE, halCycles() - start);
+    if (err != ESP_OK) {
+        writeErrors = writeErrors + 1;
+        return;
+    }
+    pagesWritten = pagesWritten + 1;
+}
@@ -0,0 +1,32 @@
+#ifndef DATALOG_ESP32_H
+#define DATALOG_ESP32_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "datalog.h"
+
+// Board side of the data log (datalog_esp32.cpp)
+
+// Create the record queue and start the logger task; the task finds and
+// maps the log partition itself
+void dataLogBegin();
+
+// Queue a record without blocking; counts and drops it if the queue is full
+bool dataLogPush(const LogRecord &record);
+
+// Page to start a download from: the one after the page being written
+uint16_t dataLogOldestPage();
+
+// Size of a full download in bytes (the Content-Length of /log), 0 while
+// the log is not mapped yet or unavailable
+size_t dataLogSize();
+
+// Read up to maxLen bytes at offset index of the download starting at firstPage;
+// returns 0 at the end or while the log is not mounted yet
+size_t dataLogRead(uint16_t firstPage, size_t index, uint8_t *buffer, size_t maxLen);
+
+uint32_t dataLogDropped();
+uint32_t dataLogPagesWritten();
+uint32_t dataLogWriteErrors();     // Page erases or writes that failed
+
+#endif
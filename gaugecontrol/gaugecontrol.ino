@@ -1,79 +1,90 @@
 #include <Arduino.h>
-#include "driver/ledc.h"  // Required for ESP32 Core v3.0.0+
 #include <WiFi.h>
 #include <ESPAsyncWebServer.h>
 #include <AsyncTCP.h>
 #include <ArduinoJson.h>
 #include <Preferences.h>
 #include <DNSServer.h>
+#include <rom/crc.h>
 #include "webui.h"
-
-// Pin Definitions
-#define MOSFET_PWM_PIN 25   // Controls gauge needle
-#define BACKLIGHT_PIN 26    // Blinks when level is low
-#define PS_CONTROL_PIN 27    // 0-5V control for power supply
-#define FLOAT_SENSOR_PIN 34  // Reads float sensor voltage
-#define H2_SIGNAL_PIN 35     // Input from H2 board coil plug (12V)
-#define I2C_SDA_PIN 21        // I2C Data (reserved for future use)
-#define I2C_SCL_PIN 22        // I2C Clock (reserved for future use)
-#define watch_dog 33          // 10ms 
-
-// PWM Configuration
-#define PWM_FREQUENCY 5000  // PWM frequency in Hz
-#define PWM_RESOLUTION LEDC_TIMER_8_BIT  // 8-bit for gauge control
-#define PWM_CHANNEL LEDC_CHANNEL_0
-
-// PWM Configuration for Power Supply Control
-#define PS_PWM_FREQ 10000
-#define PS_PWM_RES LEDC_TIMER_8_BIT
-#define PS_PWM_CHANNEL LEDC_CHANNEL_1
-
-// Float Sensor Resistance Range
-#define MAX_RESISTANCE 240  // Ohms (Empty Tank)
-#define MIN_RESISTANCE 30   // Ohms (Full Tank)
-#define KNOWN_RESISTOR 100  // Changed from 10000 to 100 ohms
-
-// PWM Range for Gauge
-#define MIN_DUTY 140         // Empty
-#define MAX_DUTY 255         // Full
-#define BLINK_THRESHOLD 10  // If PWM < 150, blink BACKLIGHT_PIN
-#define LOW_LEVEL_THRESHOLD 145  // Cut power if below this
-
-#define BLINK_INTERVAL 250   // Blink time in milliseconds
-#define NUM_SAMPLES 10       // Number of ADC samples for noise filtering
-#define STEP_DELAY_MS 20     // Delay between power ramp steps (ms)
-
-// Add these variables for watchdog timing
-unsigned long lastWatchdogTime = 0;
-#define WATCHDOG_INTERVAL 10   // 10ms interval
-
-unsigned long lastBlinkTime = 0;
-bool blinkState = false;
-float smoothedDuty = MIN_DUTY; // Start at lowest gauge position
-
-bool pem_running = false;
-uint8_t current_ramp_value = 0;
-
-// Increased smoothing factor for faster response
-#define NORMAL_SMOOTHING 0.05  // Regular smoothing (5% of new value)
-#define RECOVERY_SMOOTHING 0.25 // Faster smoothing when recovering from low level (25% of new value)
-bool wasInLowLevel = false;    // Track if we were previously in low level
+#include "hal.h"
+#include "control.h"
+#include "adcfilter.h"
+#include "metrics.h"
+#include "datalog_esp32.h"
+
+// Task layout: control runs alone on the APP core, everything network-related
+// (Wi-Fi, AsyncTCP, DNS) and serial telemetry stays on the PRO core
+#define CONTROL_TASK_CORE 1
+#define CONTROL_TASK_PRIORITY (configMAX_PRIORITIES - 2)
+#define CONTROL_TASK_STACK 4096
+#define SERVICE_TASK_CORE 0
+#define SERVICE_TASK_PRIORITY 1
+#define SERVICE_TASK_STACK 4096
+#define SERVICE_INTERVAL_MS 10       // DNS polling period
+#define TELEMETRY_INTERVAL_MS 50     // Serial debug output period
+#define METRICS_BUFFER_SIZE 1024     // /metrics response
+
+TaskHandle_t controlTaskHandle = NULL;
+TaskHandle_t serviceTaskHandle = NULL;
 
 // WiFi Configuration
 #define AP_SSID "GaugeControl"
 #define AP_PASSWORD "gaugeconfig"
 #define DNS_PORT 53
 
+// Live telemetry stream
+#define DEFAULT_STREAM_RATE_HZ 10
+#define MAX_STREAM_RATE_HZ 50
+#define WS_CLEANUP_INTERVAL_MS 1000
+#define LIVE_FRAME_TYPE 1
+#define LIVE_FLAG_PEM_RUNNING 0x01
+#define LIVE_FLAG_CHANNEL_SHIFT 4     // Top four bits: channel the frame belongs to
+
+// Binary frame broadcast to every /ws client (little-endian)
+struct __attribute__((packed)) LiveFrame {
+  uint8_t type;
+  uint8_t flags;
+  uint16_t targetDuty;
+  uint16_t smoothedDuty;
+  uint16_t rampValue;
+  uint32_t timeMs;
+  float resistance;
+  float levelRate;     // Duty/s
+  float timeToEmpty;   // Seconds, -1 when not draining
+};
+static_assert(sizeof(LiveFrame) == 24, "LiveFrame layout is shared with webui.h");
+
+int streamRateHz = DEFAULT_STREAM_RATE_HZ;
+
 // Web server and DNS server
 AsyncWebServer server(80);
+AsyncWebSocket ws("/ws");
 DNSServer dnsServer;
 Preferences preferences;
 
 // WiFi mode flags
 bool apMode = false;
 
-// Configuration structure
+// Configuration structure, stored as one blob: only ever append fields
+// (older blobs keep their values and take defaults for the new ones) and
+// bump CONFIG_VERSION. The channel array has a fixed MAX_CHANNELS entries
+// so the layout does not depend on how many channels are in use; changing
+// MAX_CHANNELS or ChannelSettings needs a migration like configFromV2().
 struct Config {
+  int blinkInterval = 250;
+  int numSamples = 10;
+  char wifiSSID[32] = "";
+  char wifiPassword[64] = "";
+  int streamRate = DEFAULT_STREAM_RATE_HZ;
+  int channelCount = DEFAULT_CHANNEL_COUNT;  // Takes effect on the next boot
+  ChannelSettings channel[MAX_CHANNELS];
+  int h2DebounceMs = DEFAULT_H2_DEBOUNCE_MS;
+  int h2GlitchUs = DEFAULT_H2_GLITCH_US;
+};
+
+// Single-channel layout written by config versions 1 and 2
+struct ConfigV2 {
   int maxResistance = 240;
   int minResistance = 30;
   int knownResistor = 100;
@@ -88,70 +99,56 @@ struct Config {
   char wifiPassword[64] = "";
   int pemMaxValue = 255;
   int pemStepSize = 1;
+  int streamRate = DEFAULT_STREAM_RATE_HZ;
+  CalPoint calibration[CAL_MAX_POINTS] = {};
+  int calibrationCount = 0;
+  int levelFilter = DEFAULT_LEVEL_FILTER;
+  float levelNoise = DEFAULT_LEVEL_NOISE;
+  float rateNoise = DEFAULT_RATE_NOISE;
+  int lowLevelLookahead = DEFAULT_LOW_LEVEL_LOOKAHEAD;
 };
 
 Config config;
 
-// Variables to store current values for the web interface
-float currentResistance = 0;
-int currentTargetDuty = 0;
-
-// Replace fixed #define values with variables
-// Keep the #define for default values
-#define DEFAULT_MAX_RESISTANCE 240
-#define DEFAULT_MIN_RESISTANCE 30
-#define DEFAULT_KNOWN_RESISTOR 100
-#define DEFAULT_MIN_DUTY 140
-#define DEFAULT_MAX_DUTY 255
-#define DEFAULT_BLINK_THRESHOLD 10
-#define DEFAULT_LOW_LEVEL_THRESHOLD 145
-#define DEFAULT_BLINK_INTERVAL 250
-#define DEFAULT_NUM_SAMPLES 10
-#define DEFAULT_STEP_DELAY_MS 20
-
-// Add default values
-#define DEFAULT_PEM_MAX_VALUE 255
-#define DEFAULT_PEM_STEP_SIZE 1
-
-// Variables that will be modified at runtime
-int maxResistance = DEFAULT_MAX_RESISTANCE;
-int minResistance = DEFAULT_MIN_RESISTANCE;
-int knownResistor = DEFAULT_KNOWN_RESISTOR;
-int minDuty = DEFAULT_MIN_DUTY;
-int maxDuty = DEFAULT_MAX_DUTY;
-int blinkThreshold = DEFAULT_BLINK_THRESHOLD;
-int lowLevelThreshold = DEFAULT_LOW_LEVEL_THRESHOLD;
-int blinkInterval = DEFAULT_BLINK_INTERVAL;
-int numSamples = DEFAULT_NUM_SAMPLES;
-int stepDelayMs = DEFAULT_STEP_DELAY_MS;
-
-// Add runtime variables
-int pemMaxValue = DEFAULT_PEM_MAX_VALUE;
-int pemStepSize = DEFAULT_PEM_STEP_SIZE;
-
-// Add this near the other global variables
-bool watchdogEnabled = false;
-unsigned long bootTime = 0;
-#define WATCHDOG_ENABLE_DELAY 5000 // 5 seconds delay before enabling watchdog
-
-// Add this to your global variables
+// Config blob storage: two NVS slots written alternately, newest valid one wins
+#define CONFIG_MAGIC 0x47464347      // "GCFG"
+#define CONFIG_VERSION 4
+#define CONFIG_BLOB_MAX 1024         // Largest blob accepted, including newer firmware's fields
+
+static_assert(sizeof(Config) <= CONFIG_BLOB_MAX, "config blob too large");
+
+struct ConfigHeader {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t size;       // Payload bytes (sizeof(Config) of the writer)
+  uint32_t sequence;   // Incremented on every save
+  uint32_t crc;        // CRC32 of the payload
+};
+
+const char *const configSlots[2] = {"cfgA", "cfgB"};
+Config savedConfig;          // Contents of the newest slot, to skip unchanged saves
+int savedSlot = -1;          // Slot holding savedConfig, -1 if nothing stored yet
+uint32_t savedSequence = 0;
+
+// Station connection runs in the background; serviceTask falls back to AP
+// mode if no IP arrives within WIFI_CONNECT_TIMEOUT_MS of boot
 #define WIFI_CONNECT_TIMEOUT_MS 10000 // 10 second timeout for WiFi connection
-hw_timer_t * watchdogTimer = NULL;
-portMUX_TYPE timerMux = portMUX_INITIALIZER_UNLOCKED;
-
-// Add this function to handle the hardware timer interrupt
-void IRAM_ATTR onTimer() {
-  portENTER_CRITICAL_ISR(&timerMux);
-  digitalWrite(watch_dog, !digitalRead(watch_dog)); // Toggle the watchdog pin
-  portEXIT_CRITICAL_ISR(&timerMux);
-}
+
+enum WifiState {
+  WIFI_STATE_CONNECTING,  // Station started, waiting for an IP
+  WIFI_STATE_CONNECTED,   // Got an IP at least once; reconnects are automatic
+  WIFI_STATE_AP           // Access point / captive portal
+};
+
+volatile WifiState wifiState = WIFI_STATE_CONNECTING;
+unsigned long wifiConnectStart = 0;
 
 void setup() {
     Serial.begin(115200);
     Serial.println("Gauge Control System Starting...");
     
     // Record boot time
-    bootTime = millis();
+    controlBegin();
     
     // Configure watchdog pin as output and set it HIGH immediately to prevent reset
     pinMode(watch_dog, OUTPUT);
@@ -161,278 +158,173 @@ void setup() {
     pinMode(I2C_SDA_PIN, INPUT);
     pinMode(I2C_SCL_PIN, INPUT);
     
-    // Initialize WiFi and web server
-    initWifi();
-
-    // Configure PWM for Gauge Control
-    ledc_timer_config_t timerConfig = {
-        .speed_mode = LEDC_LOW_SPEED_MODE,
-        .duty_resolution = PWM_RESOLUTION,
-        .timer_num = LEDC_TIMER_0,
-        .freq_hz = PWM_FREQUENCY,
-        .clk_cfg = LEDC_AUTO_CLK
-    };
-    ledc_timer_config(&timerConfig);
-
-    ledc_channel_config_t channelConfig = {
-        .gpio_num = MOSFET_PWM_PIN,
-        .speed_mode = LEDC_LOW_SPEED_MODE,
-        .channel = PWM_CHANNEL,
-        .intr_type = LEDC_INTR_DISABLE,
-        .timer_sel = LEDC_TIMER_0,
-        .duty = 0, // Initial duty cycle
-        .hpoint = 0
-    };
-    ledc_channel_config(&channelConfig);
-
-    // Configure PWM for Power Supply Control
-    ledc_timer_config_t psTimerConfig = {
-        .speed_mode = LEDC_LOW_SPEED_MODE,
-        .duty_resolution = PS_PWM_RES,
-        .timer_num = LEDC_TIMER_1,
-        .freq_hz = PS_PWM_FREQ,
-        .clk_cfg = LEDC_AUTO_CLK
-    };
-    ledc_timer_config(&psTimerConfig);
-
-    ledc_channel_config_t psChannelConfig = {
-        .gpio_num = PS_CONTROL_PIN,
-        .speed_mode = LEDC_LOW_SPEED_MODE,
-        .channel = PS_PWM_CHANNEL,
-        .intr_type = LEDC_INTR_DISABLE,
-        .timer_sel = LEDC_TIMER_1,
-        .duty = 0,
-        .hpoint = 0
-    };
-    ledc_channel_config(&psChannelConfig);
-
-    // Setup Pins
-    pinMode(BACKLIGHT_PIN, OUTPUT);
-    pinMode(H2_SIGNAL_PIN, INPUT_PULLDOWN);
-    digitalWrite(BACKLIGHT_PIN, LOW);
-
-    // Initialize power supply control to 0V
-    ledc_set_duty(LEDC_LOW_SPEED_MODE, PS_PWM_CHANNEL, 0);
-    ledc_update_duty(LEDC_LOW_SPEED_MODE, PS_PWM_CHANNEL);
-
-    Serial.println("System Initialized");
-}
-
-void loop() {
-    // Handle DNS if in AP mode
-    if (apMode) {
-        dnsServer.processNextRequest();
-    }
-    
-    // Handle watchdog signal
-    updateWatchdog();
+    // Thresholds and calibration must be in place before the first control step
+    preferences.begin("gauge-config", false);
+    loadConfig();
+    channelCount = constrain(config.channelCount, 1, MAX_CHANNELS);
 
-    // Check H2 signal
-    bool h2_signal = digitalRead(H2_SIGNAL_PIN);
+    // Configure gauge/PS PWM, GPIO and float sensor sampling
+    halBegin();
 
-    // Handle PEM start/stop based on H2 signal
-    if (h2_signal && !pem_running) {
-        startPEM();
-    } else if (!h2_signal && pem_running) {
-        stopPEM();
-    }
+    // Start the flash data log before the control task begins queueing records
+    dataLogBegin();
 
-    // Read float sensor resistance
-    float resistance = readFloatSensorResistance(FLOAT_SENSOR_PIN);
-    currentResistance = resistance; // Store for web interface
-    
-    // Convert resistance to PWM duty cycle
-    int targetDuty = map(resistance, maxResistance, minResistance, minDuty, maxDuty);
-    currentTargetDuty = targetDuty; // Store for web interface
-    
-    // Use faster recovery when coming back from low level
-    float smoothingFactor = (wasInLowLevel && targetDuty > BLINK_THRESHOLD) ? 
-                            RECOVERY_SMOOTHING : NORMAL_SMOOTHING;
-    
-    // Smooth gauge movement with adaptive smoothing
-    smoothedDuty = (smoothingFactor * targetDuty) + ((1.0 - smoothingFactor) * smoothedDuty);
+    // Gauge, H2 and safety are live from here on, independent of the network
+    xTaskCreatePinnedToCore(controlTask, "control", CONTROL_TASK_STACK, NULL,
+                            CONTROL_TASK_PRIORITY, &controlTaskHandle, CONTROL_TASK_CORE);
 
-    // Apply smoothed PWM duty cycle to gauge
-    ledc_set_duty(LEDC_LOW_SPEED_MODE, PWM_CHANNEL, (int)smoothedDuty);
-    ledc_update_duty(LEDC_LOW_SPEED_MODE, PWM_CHANNEL);
-
-    // Track if we are/were in low level state
-    bool isInLowLevel = ((int)smoothedDuty < BLINK_THRESHOLD);
-    wasInLowLevel = isInLowLevel;
+    // Start WiFi without waiting for it, then the web server
+    initWifi();
+    initWebServer();
 
-    // Handle low fill level conditions
-    manageSafety((int)smoothedDuty);
+    xTaskCreatePinnedToCore(serviceTask, "service", SERVICE_TASK_STACK, NULL,
+                            SERVICE_TASK_PRIORITY, &serviceTaskHandle, SERVICE_TASK_CORE);
 
-    // Debug Output (shortened for simplicity)
-    Serial.print("R: ");
-    Serial.print(resistance);
-    Serial.print(" | T: ");
-    Serial.print(targetDuty);
-    Serial.print(" | S: ");
-    Serial.println((int)smoothedDuty);
+    Serial.println("System Initialized");
+}
 
-    delay(50);
+void loop() {
+    // All work happens in controlTask and serviceTask
+    vTaskDelete(NULL);
 }
 
-void startPEM() {
-    Serial.println("Starting PEM - Ramping power supply");
-    pem_running = true;
-    
-    // Ramp from 0 to max value using step size
-    for (current_ramp_value = 0; current_ramp_value <= pemMaxValue; current_ramp_value += pemStepSize) {
-        ledc_set_duty(LEDC_LOW_SPEED_MODE, PS_PWM_CHANNEL, current_ramp_value);
-        ledc_update_duty(LEDC_LOW_SPEED_MODE, PS_PWM_CHANNEL);
-        delay(stepDelayMs);
-    }
-    
-    // Ensure we reach exactly the max value
-    if (current_ramp_value > pemMaxValue) {
-        ledc_set_duty(LEDC_LOW_SPEED_MODE, PS_PWM_CHANNEL, pemMaxValue);
-        ledc_update_duty(LEDC_LOW_SPEED_MODE, PS_PWM_CHANNEL);
+// Fixed-rate control loop pinned to CONTROL_TASK_CORE
+void controlTask(void *param) {
+    TickType_t lastWakeTime = xTaskGetTickCount();
+    const TickType_t period = pdMS_TO_TICKS(CONTROL_PERIOD_MS);
+
+    for (;;) {
+        controlStep();
+        vTaskDelayUntil(&lastWakeTime, period);
     }
 }
 
-void stopPEM() {
-    Serial.println("Stopping PEM");
-    pem_running = false;
-    
-    // Immediately set power supply control to 0
-    ledc_set_duty(LEDC_LOW_SPEED_MODE, PS_PWM_CHANNEL, 0);
-    ledc_update_duty(LEDC_LOW_SPEED_MODE, PS_PWM_CHANNEL);
-    current_ramp_value = 0;
-}
+// DNS, serial telemetry and the live stream, kept off the control core
+void serviceTask(void *param) {
+    unsigned long lastTelemetryTime = 0;
+    unsigned long lastStreamTime = 0;
+    unsigned long lastCleanupTime = 0;
+    bool firstActuationPrinted = false;
+
+    for (;;) {
+        // Handle DNS if in AP mode
+        if (apMode) {
+            dnsServer.processNextRequest();
+        }
 
-// Function to read float sensor resistance using a voltage divider
-float readFloatSensorResistance(int pin) {
-    int adcValue = readSmoothADC(pin);
-    float voltage = (adcValue / 4095.0) * 3.3;  // Convert ADC to voltage
-    
-    if (voltage <= 0.1) return MAX_RESISTANCE;  // Default to empty if sensor fails
+        // Messages queued by the control task
+        halPrintLog();
 
-    // Use Ohm's law: R_sensor = (V / (3.3 - V)) * Known_Resistor
-    float resistance = (voltage / (3.3 - voltage)) * knownResistor;
-    return resistance;
-}
+        // Only known once the control task has written a gauge output, which
+        // waits for the first ADC frame
+        if (!firstActuationPrinted && metricsBootMilestoneUs(BOOT_FIRST_ACTUATION) != 0) {
+            firstActuationPrinted = true;
+            Serial.printf("First actuation %.1f ms after startup\n",
+                          metricsBootMilestoneUs(BOOT_FIRST_ACTUATION) / 1000.0);
+        }
 
-// Function to filter ADC noise (Moving Average)
-int readSmoothADC(int pin) {
-    int total = 0;
-    for (int i = 0; i < NUM_SAMPLES; i++) {
-        total += analogRead(pin);
-        delayMicroseconds(500);
-    }
-    return total / NUM_SAMPLES;
-}
+        unsigned long currentMillis = millis();
+        if (wifiState == WIFI_STATE_CONNECTING && currentMillis - wifiConnectStart >= WIFI_CONNECT_TIMEOUT_MS) {
+            Serial.println("WiFi connection timed out");
+            WiFi.disconnect();
+            startAPMode();
+        }
 
-// Function to manage low-level conditions
-void manageSafety(int pwmDuty) {
-    unsigned long currentMillis = millis();
+        if (currentMillis - lastTelemetryTime >= TELEMETRY_INTERVAL_MS) {
+            lastTelemetryTime = currentMillis;
+            ScopedMetric timing(METRIC_TELEMETRY);
+            for (int ch = 0; ch < channelCount; ch++) {
+                LiveData live = readLiveData(ch);
+
+                // Debug Output (shortened for simplicity)
+                if (channelCount > 1) {
+                    Serial.print(ch);
+                    Serial.print(" ");
+                }
+                Serial.print("R: ");
+                Serial.print(live.resistance);
+                Serial.print(" | T: ");
+                Serial.print(live.targetDuty);
+                Serial.print(" | S: ");
+                Serial.println(live.smoothedDuty);
+            }
+        }
 
-    // Blink Backlight if below threshold
-    if (pwmDuty < blinkThreshold) {
-        if (currentMillis - lastBlinkTime >= blinkInterval) {
-            lastBlinkTime = currentMillis;
-            blinkState = !blinkState;
-            digitalWrite(BACKLIGHT_PIN, blinkState);
+        unsigned long streamInterval = 1000 / constrain(streamRateHz, 1, MAX_STREAM_RATE_HZ);
+        if (currentMillis - lastStreamTime >= streamInterval) {
+            lastStreamTime = currentMillis;
+            broadcastLiveFrame();
         }
-    } else {
-        // Reset blinking state and set backlight HIGH when above threshold
-        blinkState = false;
-        digitalWrite(BACKLIGHT_PIN, HIGH);
-    }
 
-    // If level is too low, shut down power supply by setting control voltage to 0
-    if (pwmDuty < lowLevelThreshold) {
-        Serial.println("Low level detected! Shutting down power supply.");
-        ledc_set_duty(LEDC_LOW_SPEED_MODE, PS_PWM_CHANNEL, 0);
-        ledc_update_duty(LEDC_LOW_SPEED_MODE, PS_PWM_CHANNEL);
-        pem_running = false;
-    }
-}
+        if (currentMillis - lastCleanupTime >= WS_CLEANUP_INTERVAL_MS) {
+            lastCleanupTime = currentMillis;
+            ws.cleanupClients();
+        }
 
-void blinkBacklight() {
-    unsigned long currentMillis = millis();
-    if (currentMillis - lastBlinkTime >= blinkInterval) {
-        lastBlinkTime = currentMillis;
-        blinkState = !blinkState;
-        digitalWrite(BACKLIGHT_PIN, blinkState);
+        vTaskDelay(pdMS_TO_TICKS(SERVICE_INTERVAL_MS));
     }
 }
 
-// Update the watchdog function
-void updateWatchdog() {
-    unsigned long currentMillis = millis();
-    
-    // Only enable watchdog after a safe boot period
-    if (!watchdogEnabled && (currentMillis - bootTime > WATCHDOG_ENABLE_DELAY)) {
-        watchdogEnabled = true;
-        Serial.println("Watchdog activated");
-    }
-    
-    // Simply toggle the watchdog pin at the required interval
-    if (watchdogEnabled && (currentMillis - lastWatchdogTime >= WATCHDOG_INTERVAL)) {
-        lastWatchdogTime = currentMillis;
-        digitalWrite(watch_dog, !digitalRead(watch_dog)); // Toggle
+// Serialize each channel's latest snapshot once and queue the same buffer
+// to every client
+void broadcastLiveFrame() {
+    if (ws.count() == 0) return;
+
+    for (int ch = 0; ch < channelCount; ch++) {
+        LiveData live = readLiveData(ch);
+        LiveFrame frame;
+        frame.type = LIVE_FRAME_TYPE;
+        frame.flags = (live.pemRunning ? LIVE_FLAG_PEM_RUNNING : 0) | (ch << LIVE_FLAG_CHANNEL_SHIFT);
+        frame.targetDuty = constrain(live.targetDuty, 0, 0xFFFF);
+        frame.smoothedDuty = constrain(live.smoothedDuty, 0, 0xFFFF);
+        frame.rampValue = live.rampValue;
+        frame.timeMs = millis();
+        frame.resistance = live.resistance;
+        frame.levelRate = live.levelRate;
+        frame.timeToEmpty = live.timeToEmpty;
+
+        AsyncWebSocketMessageBuffer *buffer = ws.makeBuffer(sizeof(frame));
+        if (buffer == NULL) return;
+        memcpy(buffer->get(), &frame, sizeof(frame));
+        ws.binaryAll(buffer);
     }
 }
 
 void initWifi() {
-  preferences.begin("gauge-config", false);
-  
-  // Start a hardware timer to handle watchdog during WiFi connection
-  watchdogTimer = timerBegin(0, 80, true); // Timer 0, divider 80 (1MHz)
-  timerAttachInterrupt(watchdogTimer, &onTimer, true);
-  timerAlarmWrite(watchdogTimer, 5000, true); // 5ms toggle (10ms period)
-  timerAlarmEnable(watchdogTimer);
-
-  // Load stored WiFi credentials
-  if (preferences.getString("wifiSSID", "").length() > 0) {
-    String ssid = preferences.getString("wifiSSID", "");
-    String password = preferences.getString("wifiPassword", "");
-    
-    ssid.toCharArray(config.wifiSSID, sizeof(config.wifiSSID));
-    password.toCharArray(config.wifiPassword, sizeof(config.wifiPassword));
-    
-    // Try to connect to stored WiFi with timeout
+  WiFi.onEvent(onWifiEvent);
+
+  if (strlen(config.wifiSSID) > 0) {
+    // Connect in the background; onWifiEvent() reports the result
     WiFi.mode(WIFI_STA);
+    WiFi.setAutoReconnect(true);
+    wifiConnectStart = millis();
+    wifiState = WIFI_STATE_CONNECTING;
     WiFi.begin(config.wifiSSID, config.wifiPassword);
-    
-    Serial.print("Connecting to WiFi");
-    
-    unsigned long startTime = millis();
-    while (WiFi.status() != WL_CONNECTED && millis() - startTime < WIFI_CONNECT_TIMEOUT_MS) {
-      delay(100); // Shorter delay
-      Serial.print(".");
-      
-      // Keep watchdog happy manually in addition to the timer
-      digitalWrite(watch_dog, HIGH);
-      delayMicroseconds(100);
-      digitalWrite(watch_dog, LOW);
-    }
-    
-    if (WiFi.status() == WL_CONNECTED) {
-      Serial.println("");
-      Serial.print("Connected to WiFi. IP: ");
-      Serial.println(WiFi.localIP());
-      apMode = false;
-    } else {
-      WiFi.disconnect();
-      startAPMode();
-    }
+    Serial.println("Connecting to WiFi");
   } else {
     startAPMode();
   }
-  
-  // Disable the hardware timer once WiFi is connected
-  timerAlarmDisable(watchdogTimer);
-  timerDetachInterrupt(watchdogTimer);
-  timerEnd(watchdogTimer);
-  
-  // Load other configuration values
-  loadConfig();
-  
-  // Initialize web server
-  initWebServer();
+}
+
+// Runs in the WiFi event task
+void onWifiEvent(WiFiEvent_t event, WiFiEventInfo_t info) {
+  switch (event) {
+    case ARDUINO_EVENT_WIFI_STA_GOT_IP:
+      if (wifiState == WIFI_STATE_AP) break;
+      wifiState = WIFI_STATE_CONNECTED;
+      apMode = false;
+      metricsBootMilestone(BOOT_NETWORK_READY);
+      Serial.print("Connected to WiFi. IP: ");
+      Serial.println(WiFi.localIP());
+      break;
+    case ARDUINO_EVENT_WIFI_STA_DISCONNECTED:
+      if (wifiState == WIFI_STATE_CONNECTED) {
+        Serial.println("WiFi disconnected, reconnecting");
+      }
+      break;
+    default:
+      break;
+  }
 }
 
 void startAPMode() {
@@ -446,78 +338,219 @@ void startAPMode() {
   // Start DNS server to redirect all domains to the captive portal
   dnsServer.start(DNS_PORT, "*", WiFi.softAPIP());
   
+  wifiState = WIFI_STATE_AP;
   apMode = true;
+  metricsBootMilestone(BOOT_NETWORK_READY);
 }
 
 void loadConfig() {
-  config.maxResistance = preferences.getInt("maxResistance", DEFAULT_MAX_RESISTANCE);
-  config.minResistance = preferences.getInt("minResistance", DEFAULT_MIN_RESISTANCE);
-  config.knownResistor = preferences.getInt("knownResistor", DEFAULT_KNOWN_RESISTOR);
-  config.minDuty = preferences.getInt("minDuty", DEFAULT_MIN_DUTY);
-  config.maxDuty = preferences.getInt("maxDuty", DEFAULT_MAX_DUTY);
-  config.blinkThreshold = preferences.getInt("blinkThreshold", DEFAULT_BLINK_THRESHOLD);
-  config.lowLevelThreshold = preferences.getInt("lowLevelThreshold", DEFAULT_LOW_LEVEL_THRESHOLD);
+  int slot = -1;
+  ConfigHeader header;
+  for (int i = 0; i < 2; i++) {
+    ConfigHeader slotHeader;
+    Config slotConfig;
+    if (readConfigSlot(i, slotHeader, slotConfig) && (slot < 0 || slotHeader.sequence > header.sequence)) {
+      slot = i;
+      header = slotHeader;
+      config = slotConfig;
+    }
+  }
+
+  if (slot >= 0) {
+    savedConfig = config;
+    savedSlot = slot;
+    savedSequence = header.sequence;
+    if (header.version != CONFIG_VERSION || header.size != sizeof(Config)) {
+      Serial.printf("Migrating config from version %d\n", header.version);
+      writeConfigBlob();
+    }
+  } else if (preferences.isKey("maxResistance")) {
+    Serial.println("Migrating config from individual keys");
+    loadLegacyConfig();
+    if (writeConfigBlob()) {
+      removeLegacyConfig();
+    }
+  }
+
+  applyConfig();
+}
+
+// Apply config and store it unless it matches what is already stored
+bool saveConfig() {
+  applyConfig();
+  return configChanged() ? writeConfigBlob() : true;
+}
+
+bool configChanged() {
+  return savedSlot < 0 || memcmp(&config, &savedConfig, sizeof(Config)) != 0;
+}
+
+// Write config to the slot not holding the newest copy
+bool writeConfigBlob() {
+  static uint8_t blob[sizeof(ConfigHeader) + sizeof(Config)];
+  ConfigHeader header;
+  header.magic = CONFIG_MAGIC;
+  header.version = CONFIG_VERSION;
+  header.size = sizeof(Config);
+  header.sequence = savedSequence + 1;
+  header.crc = crc32_le(0, (const uint8_t *)&config, sizeof(Config));
+  memcpy(blob, &header, sizeof(header));
+  memcpy(blob + sizeof(header), &config, sizeof(Config));
+
+  // Never overwrite the newest good copy: a power loss mid-write leaves it intact
+  int slot = (savedSlot == 0) ? 1 : 0;
+  if (preferences.putBytes(configSlots[slot], blob, sizeof(blob)) != sizeof(blob)) {
+    Serial.println("Config save failed");
+    return false;
+  }
+
+  savedConfig = config;
+  savedSlot = slot;
+  savedSequence = header.sequence;
+  return true;
+}
+
+// Read and validate one slot. Blobs from other firmware versions are
+// accepted: missing trailing fields keep their defaults, extra ones are
+// dropped, and single-channel blobs are converted.
+bool readConfigSlot(int slot, ConfigHeader &header, Config &out) {
+  static uint8_t blob[sizeof(ConfigHeader) + CONFIG_BLOB_MAX];
+  size_t length = preferences.getBytesLength(configSlots[slot]);
+  if (length < sizeof(ConfigHeader) || length > sizeof(blob)) return false;
+  if (preferences.getBytes(configSlots[slot], blob, length) != length) return false;
+
+  memcpy(&header, blob, sizeof(header));
+  const uint8_t *payload = blob + sizeof(header);
+  if (header.magic != CONFIG_MAGIC || header.size != length - sizeof(header) ||
+      header.crc != crc32_le(0, payload, header.size)) {
+    Serial.printf("Config slot %s is invalid\n", configSlots[slot]);
+    return false;
+  }
+
+  if (header.version < 3) {
+    ConfigV2 old;
+    memcpy(&old, payload, min((size_t)header.size, sizeof(ConfigV2)));
+    configFromV2(old, out);
+    return true;
+  }
+
+  out = Config();
+  memcpy(&out, payload, min((size_t)header.size, sizeof(Config)));
+  return true;
+}
+
+// Configuration stored by firmware before the blob format
+void loadLegacyConfig() {
+  ChannelSettings &c = config.channel[0];
+  c.maxResistance = preferences.getInt("maxResistance", DEFAULT_MAX_RESISTANCE);
+  c.minResistance = preferences.getInt("minResistance", DEFAULT_MIN_RESISTANCE);
+  c.knownResistor = preferences.getInt("knownResistor", DEFAULT_KNOWN_RESISTOR);
+  c.minDuty = preferences.getInt("minDuty", DEFAULT_MIN_DUTY);
+  c.maxDuty = preferences.getInt("maxDuty", DEFAULT_MAX_DUTY);
+  c.blinkThreshold = preferences.getInt("blinkThreshold", DEFAULT_BLINK_THRESHOLD);
+  c.lowLevelThreshold = preferences.getInt("lowLevelThreshold", DEFAULT_LOW_LEVEL_THRESHOLD);
   config.blinkInterval = preferences.getInt("blinkInterval", DEFAULT_BLINK_INTERVAL);
   config.numSamples = preferences.getInt("numSamples", DEFAULT_NUM_SAMPLES);
-  config.stepDelay = preferences.getInt("stepDelay", DEFAULT_STEP_DELAY_MS);
-  config.pemMaxValue = preferences.getInt("pemMaxValue", DEFAULT_PEM_MAX_VALUE);
-  config.pemStepSize = preferences.getInt("pemStepSize", DEFAULT_PEM_STEP_SIZE);
-  
-  // Update the runtime variables with loaded configuration
-  maxResistance = config.maxResistance;
-  minResistance = config.minResistance;
-  knownResistor = config.knownResistor;
-  minDuty = config.minDuty;
-  maxDuty = config.maxDuty;
-  blinkThreshold = config.blinkThreshold;
-  lowLevelThreshold = config.lowLevelThreshold;
-  blinkInterval = config.blinkInterval;
-  numSamples = config.numSamples;
-  stepDelayMs = config.stepDelay;
-  pemMaxValue = config.pemMaxValue;
-  pemStepSize = config.pemStepSize;
+  c.stepDelayMs = preferences.getInt("stepDelay", DEFAULT_STEP_DELAY_MS);
+  c.pemMaxValue = preferences.getInt("pemMaxValue", DEFAULT_PEM_MAX_VALUE);
+  c.pemStepSize = preferences.getInt("pemStepSize", DEFAULT_PEM_STEP_SIZE);
+  config.streamRate = preferences.getInt("streamRate", DEFAULT_STREAM_RATE_HZ);
+  c.calibrationCount = preferences.getInt("calCount", 0);
+  if (preferences.getBytes("calibration", c.calibration, sizeof(c.calibration)) != sizeof(c.calibration)) {
+    c.calibrationCount = 0;
+  }
+  preferences.getString("wifiSSID", "").toCharArray(config.wifiSSID, sizeof(config.wifiSSID));
+  preferences.getString("wifiPassword", "").toCharArray(config.wifiPassword, sizeof(config.wifiPassword));
 }
 
-void saveConfig() {
-  preferences.putInt("maxResistance", config.maxResistance);
-  preferences.putInt("minResistance", config.minResistance);
-  preferences.putInt("knownResistor", config.knownResistor);
-  preferences.putInt("minDuty", config.minDuty);
-  preferences.putInt("maxDuty", config.maxDuty);
-  preferences.putInt("blinkThreshold", config.blinkThreshold);
-  preferences.putInt("lowLevelThreshold", config.lowLevelThreshold);
-  preferences.putInt("blinkInterval", config.blinkInterval);
-  preferences.putInt("numSamples", config.numSamples);
-  preferences.putInt("stepDelay", config.stepDelay);
-  preferences.putInt("pemMaxValue", config.pemMaxValue);
-  preferences.putInt("pemStepSize", config.pemStepSize);
-  preferences.putString("wifiSSID", config.wifiSSID);
-  preferences.putString("wifiPassword", config.wifiPassword);
-  
-  // Update the runtime variables with saved configuration
-  maxResistance = config.maxResistance;
-  minResistance = config.minResistance;
-  knownResistor = config.knownResistor;
-  minDuty = config.minDuty;
-  maxDuty = config.maxDuty;
-  blinkThreshold = config.blinkThreshold;
-  lowLevelThreshold = config.lowLevelThreshold;
+void removeLegacyConfig() {
+  const char *const keys[] = {
+    "maxResistance", "minResistance", "knownResistor", "minDuty", "maxDuty",
+    "blinkThreshold", "lowLevelThreshold", "blinkInterval", "numSamples", "stepDelay",
+    "pemMaxValue", "pemStepSize", "streamRate", "calCount", "calibration",
+    "wifiSSID", "wifiPassword"
+  };
+  for (const char *key : keys) {
+    preferences.remove(key);
+  }
+}
+
+// Update the runtime variables from config. channelCount is only taken at
+// boot, before halBegin() sets up the pins.
+void applyConfig() {
   blinkInterval = config.blinkInterval;
   numSamples = config.numSamples;
-  stepDelayMs = config.stepDelay;
-  pemMaxValue = config.pemMaxValue;
-  pemStepSize = config.pemStepSize;
+  streamRateHz = config.streamRate;
+  config.h2DebounceMs = constrain(config.h2DebounceMs, 0, H2_DEBOUNCE_MAX_MS);
+  config.h2GlitchUs = constrain(config.h2GlitchUs, 0, H2_GLITCH_MAX_US);
+  h2DebounceMs = config.h2DebounceMs;
+  h2GlitchUs = config.h2GlitchUs;
+  for (int ch = 0; ch < MAX_CHANNELS; ch++) {
+    config.channel[ch].calibrationCount = constrain(config.channel[ch].calibrationCount, 0, CAL_MAX_POINTS);
+    controlSetSettings(ch, config.channel[ch]);
+  }
+}
+
+// Settings from a version 1 or 2 blob go to channel 0
+void configFromV2(const ConfigV2 &old, Config &out) {
+  out = Config();
+  out.blinkInterval = old.blinkInterval;
+  out.numSamples = old.numSamples;
+  memcpy(out.wifiSSID, old.wifiSSID, sizeof(out.wifiSSID));
+  memcpy(out.wifiPassword, old.wifiPassword, sizeof(out.wifiPassword));
+  out.streamRate = old.streamRate;
+
+  ChannelSettings &c = out.channel[0];
+  c.maxResistance = old.maxResistance;
+  c.minResistance = old.minResistance;
+  c.knownResistor = old.knownResistor;
+  c.minDuty = old.minDuty;
+  c.maxDuty = old.maxDuty;
+  c.blinkThreshold = old.blinkThreshold;
+  c.lowLevelThreshold = old.lowLevelThreshold;
+  c.stepDelayMs = old.stepDelay;
+  c.pemMaxValue = old.pemMaxValue;
+  c.pemStepSize = old.pemStepSize;
+  memcpy(c.calibration, old.calibration, sizeof(c.calibration));
+  c.calibrationCount = old.calibrationCount;
+  c.levelFilter = old.levelFilter;
+  c.levelNoise = old.levelNoise;
+  c.rateNoise = old.rateNoise;
+  c.lowLevelLookahead = old.lowLevelLookahead;
+}
+
+// Channel selected with ?channel=N (0 without it), or -1 if not below limit
+int requestChannel(AsyncWebServerRequest *request, int limit) {
+  if (!request->hasParam("channel")) return 0;
+  int ch = request->getParam("channel")->value().toInt();
+  return (ch >= 0 && ch < limit) ? ch : -1;
 }
 
 void initWebServer() {
-  // Serve the main page
+  // Serve the main page: gzipped from flash, revalidated with its ETag
   server.on("/", HTTP_GET, [](AsyncWebServerRequest *request) {
-    request->send_P(200, "text/html", index_html);
+    ScopedMetric timing(METRIC_HTTP);
+    AsyncWebServerResponse *response;
+    if (request->hasHeader("If-None-Match") && request->getHeader("If-None-Match")->value() == INDEX_HTML_ETAG) {
+      response = request->beginResponse(304);
+    } else {
+      response = request->beginResponse_P(200, "text/html", index_html_gz, index_html_gz_len);
+      response->addHeader("Content-Encoding", "gzip");
+    }
+    response->addHeader("ETag", INDEX_HTML_ETAG);
+    response->addHeader("Cache-Control", "no-cache");
+    request->send(response);
   });
   
-  // Get current configuration
+  // Get current configuration: shared settings and those of ?channel=N
   server.on("/config", HTTP_GET, [](AsyncWebServerRequest *request) {
-    String jsonResponse = getConfigJSON();
+    ScopedMetric timing(METRIC_HTTP);
+    int ch = requestChannel(request, MAX_CHANNELS);
+    if (ch < 0) {
+      request->send(404, "application/json", "{\"status\":\"error\",\"message\":\"No such channel\"}");
+      return;
+    }
+    String jsonResponse = getConfigJSON(ch);
     request->send(200, "application/json", jsonResponse);
   });
   
@@ -526,7 +559,14 @@ void initWebServer() {
     // Handle empty POST
     request->send(200, "application/json", "{\"status\":\"error\",\"message\":\"No data provided\"}");
   }, NULL, [](AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) {
-    DynamicJsonDocument doc(1024);
+    ScopedMetric timing(METRIC_HTTP);
+    int ch = requestChannel(request, MAX_CHANNELS);
+    if (ch < 0) {
+      request->send(404, "application/json", "{\"status\":\"error\",\"message\":\"No such channel\"}");
+      return;
+    }
+
+    DynamicJsonDocument doc(2048);
     DeserializationError error = deserializeJson(doc, data, len);
     
     if (error) {
@@ -534,19 +574,44 @@ void initWebServer() {
       return;
     }
     
-    // Update configuration
-    config.maxResistance = doc["maxResistance"] | 240;
-    config.minResistance = doc["minResistance"] | 30;
-    config.knownResistor = doc["knownResistor"] | 100;
-    config.minDuty = doc["minDuty"] | 140;
-    config.maxDuty = doc["maxDuty"] | 255;
-    config.blinkThreshold = doc["blinkThreshold"] | 10;
-    config.lowLevelThreshold = doc["lowLevelThreshold"] | 145;
-    config.blinkInterval = doc["blinkInterval"] | 250;
-    config.numSamples = doc["numSamples"] | 10;
-    config.stepDelay = doc["stepDelay"] | 20;
-    config.pemMaxValue = doc["pemMaxValue"] | 255;
-    config.pemStepSize = doc["pemStepSize"] | 1;
+    // Update shared configuration. Every value is clamped, so a hand-made
+    // request cannot stall the ramp (a step of 0), overflow a duty or feed
+    // the estimator a zero noise.
+    config.blinkInterval = constrain(doc["blinkInterval"] | 250, 50, 1000);
+    config.numSamples = constrain(doc["numSamples"] | 10, 1, ADC_WINDOW_MAX);
+    config.streamRate = constrain(doc["streamRate"] | DEFAULT_STREAM_RATE_HZ, 1, MAX_STREAM_RATE_HZ);
+    config.h2DebounceMs = constrain(doc["h2DebounceMs"] | DEFAULT_H2_DEBOUNCE_MS, 0, H2_DEBOUNCE_MAX_MS);
+    config.h2GlitchUs = constrain(doc["h2GlitchUs"] | DEFAULT_H2_GLITCH_US, 0, H2_GLITCH_MAX_US);
+    config.channelCount = constrain(doc["channelCount"] | config.channelCount, 1, MAX_CHANNELS);
+
+    // Update the selected channel
+    ChannelSettings &c = config.channel[ch];
+    c.maxResistance = constrain(doc["maxResistance"] | 240, 0, 1000);
+    c.minResistance = constrain(doc["minResistance"] | 30, 0, 1000);
+    c.knownResistor = constrain(doc["knownResistor"] | 100, 1, 10000);
+    c.minDuty = constrain(doc["minDuty"] | 140, 0, 255);
+    c.maxDuty = constrain(doc["maxDuty"] | 255, 0, 255);
+    c.blinkThreshold = constrain(doc["blinkThreshold"] | 10, 0, 255);
+    c.lowLevelThreshold = constrain(doc["lowLevelThreshold"] | 145, 0, 255);
+    c.stepDelayMs = constrain(doc["stepDelay"] | 20, 1, 1000);
+    c.pemMaxValue = constrain(doc["pemMaxValue"] | 255, 0, 255);
+    c.pemStepSize = constrain(doc["pemStepSize"] | 1, 1, 255);
+    c.levelFilter = constrain(doc["levelFilter"] | DEFAULT_LEVEL_FILTER, LEVEL_FILTER_EMA, LEVEL_FILTER_KALMAN);
+    c.levelNoise = constrain(doc["levelNoise"] | DEFAULT_LEVEL_NOISE, 0.1f, 50.0f);
+    c.rateNoise = constrain(doc["rateNoise"] | DEFAULT_RATE_NOISE, 0.001f, 1.0f);
+    c.lowLevelLookahead = constrain(doc["lowLevelLookahead"] | DEFAULT_LOW_LEVEL_LOOKAHEAD, 0, 120);
+    
+    // Calibration curve; left unchanged if the client did not send one
+    if (doc.containsKey("calibration")) {
+      JsonArray points = doc["calibration"].as<JsonArray>();
+      c.calibrationCount = 0;
+      for (JsonVariant point : points) {
+        if (c.calibrationCount >= CAL_MAX_POINTS) break;
+        CalPoint &p = c.calibration[c.calibrationCount++];
+        p.resistance = constrain(point["resistance"] | 0.0f, 0.0f, 10000.0f);
+        p.duty = constrain(point["duty"] | 0, 0, 255);
+      }
+    }
     
     // Handle WiFi credentials
     if (doc.containsKey("wifiSSID") && doc["wifiSSID"].as<String>().length() > 0) {
@@ -559,43 +624,94 @@ void initWebServer() {
       config.wifiPassword[sizeof(config.wifiPassword) - 1] = '\0';
     }
     
-    // Save configuration
-    saveConfig();
-    
-    request->send(200, "application/json", "{\"status\":\"success\",\"message\":\"Configuration saved\"}");
+    // Save configuration; an identical config is not rewritten
+    bool changed = configChanged();
+    if (!saveConfig()) {
+      request->send(500, "application/json", "{\"status\":\"error\",\"message\":\"Failed to save configuration\"}");
+    } else if (changed && config.channelCount != channelCount) {
+      request->send(200, "application/json", "{\"status\":\"success\",\"message\":\"Configuration saved, restart to change the channel count\"}");
+    } else if (changed) {
+      request->send(200, "application/json", "{\"status\":\"success\",\"message\":\"Configuration saved\"}");
+    } else {
+      request->send(200, "application/json", "{\"status\":\"success\",\"message\":\"Configuration unchanged\"}");
+    }
   });
   
-  // Reset to defaults
+  // Reset the shared settings and those of ?channel=N to defaults
   server.on("/reset", HTTP_POST, [](AsyncWebServerRequest *request) {
+    ScopedMetric timing(METRIC_HTTP);
+    int ch = requestChannel(request, MAX_CHANNELS);
+    if (ch < 0) {
+      request->send(404, "application/json", "{\"status\":\"error\",\"message\":\"No such channel\"}");
+      return;
+    }
+
     // Reset configuration to defaults
-    config.maxResistance = 240;
-    config.minResistance = 30;
-    config.knownResistor = 100;
-    config.minDuty = 140;
-    config.maxDuty = 255;
-    config.blinkThreshold = 10;
-    config.lowLevelThreshold = 145;
     config.blinkInterval = 250;
     config.numSamples = 10;
-    config.stepDelay = 20;
-    config.pemMaxValue = 255;
-    config.pemStepSize = 1;
-    // Don't reset WiFi credentials
+    config.streamRate = DEFAULT_STREAM_RATE_HZ;
+    config.h2DebounceMs = DEFAULT_H2_DEBOUNCE_MS;
+    config.h2GlitchUs = DEFAULT_H2_GLITCH_US;
+    config.channel[ch] = ChannelSettings();
+    // Don't reset WiFi credentials or the channel count
     
     saveConfig();
     
-    String jsonResponse = getConfigJSON();
+    String jsonResponse = getConfigJSON(ch);
     request->send(200, "application/json", jsonResponse);
   });
   
-  // Get live data
+  // Get live data of ?channel=N
   server.on("/livedata", HTTP_GET, [](AsyncWebServerRequest *request) {
-    char jsonBuffer[128];
+    ScopedMetric timing(METRIC_HTTP);
+    int ch = requestChannel(request, channelCount);
+    if (ch < 0) {
+      request->send(404, "application/json", "{\"status\":\"error\",\"message\":\"No such channel\"}");
+      return;
+    }
+    LiveData live = readLiveData(ch);
+    char jsonBuffer[192];
     snprintf(jsonBuffer, sizeof(jsonBuffer), 
-        "{\"resistance\":%.1f,\"targetDuty\":%d,\"smoothedDuty\":%d,\"pemRunning\":%s}", 
-        currentResistance, currentTargetDuty, (int)smoothedDuty, pem_running ? "true" : "false");
+        "{\"channel\":%d,\"resistance\":%.1f,\"targetDuty\":%d,\"smoothedDuty\":%d,\"pemRunning\":%s,"
+        "\"levelRate\":%.3f,\"timeToEmpty\":%.0f}", 
+        ch, live.resistance, live.targetDuty, live.smoothedDuty, live.pemRunning ? "true" : "false",
+        live.levelRate, live.timeToEmpty);
     request->send(200, "application/json", jsonBuffer);
   });
+
+  // Live telemetry stream; frames are pushed from serviceTask
+  server.addHandler(&ws);
+
+  // Stage timing histograms, loop jitter and watchdog gaps; ?reset=1 clears them
+  server.on("/metrics", HTTP_GET, [](AsyncWebServerRequest *request) {
+    static char metricsBuffer[METRICS_BUFFER_SIZE];
+    size_t length = metricsFormat(metricsBuffer, sizeof(metricsBuffer));
+    snprintf(metricsBuffer + length, sizeof(metricsBuffer) - length,
+             "log_pages_written %lu\nlog_records_dropped %lu\nlog_write_errors %lu\n",
+             (unsigned long)dataLogPagesWritten(), (unsigned long)dataLogDropped(),
+             (unsigned long)dataLogWriteErrors());
+    if (request->hasParam("reset")) {
+      metricsReset();
+    }
+    request->send(200, "text/plain", metricsBuffer);
+  });
+
+  // Binary data log, oldest page first; decode with tools/logdecode
+  server.on("/log", HTTP_GET, [](AsyncWebServerRequest *request) {
+    ScopedMetric timing(METRIC_HTTP);
+    size_t size = dataLogSize();
+    if (size == 0) {
+      request->send(503, "text/plain", "Data log not available");
+      return;
+    }
+    uint16_t firstPage = dataLogOldestPage();
+    AsyncWebServerResponse *response = request->beginResponse("application/octet-stream", size,
+        [firstPage](uint8_t *buffer, size_t maxLen, size_t index) -> size_t {
+      return dataLogRead(firstPage, index, buffer, maxLen);
+    });
+    response->addHeader("Content-Disposition", "attachment; filename=\"gaugelog.bin\"");
+    request->send(response);
+  });
   
   // Handle not found - redirect to root
   server.onNotFound([](AsyncWebServerRequest *request){
@@ -606,21 +722,39 @@ void initWebServer() {
   server.begin();
 }
 
-String getConfigJSON() {
-  DynamicJsonDocument doc(1024);
+String getConfigJSON(int ch) {
+  DynamicJsonDocument doc(2048);
+  const ChannelSettings &c = config.channel[ch];
   
-  doc["maxResistance"] = config.maxResistance;
-  doc["minResistance"] = config.minResistance;
-  doc["knownResistor"] = config.knownResistor;
-  doc["minDuty"] = config.minDuty;
-  doc["maxDuty"] = config.maxDuty;
-  doc["blinkThreshold"] = config.blinkThreshold;
-  doc["lowLevelThreshold"] = config.lowLevelThreshold;
+  doc["channel"] = ch;
+  doc["channelCount"] = config.channelCount;
+  doc["activeChannels"] = channelCount;
+  doc["maxChannels"] = MAX_CHANNELS;
+  doc["maxResistance"] = c.maxResistance;
+  doc["minResistance"] = c.minResistance;
+  doc["knownResistor"] = c.knownResistor;
+  doc["minDuty"] = c.minDuty;
+  doc["maxDuty"] = c.maxDuty;
+  doc["blinkThreshold"] = c.blinkThreshold;
+  doc["lowLevelThreshold"] = c.lowLevelThreshold;
   doc["blinkInterval"] = config.blinkInterval;
   doc["numSamples"] = config.numSamples;
-  doc["stepDelay"] = config.stepDelay;
-  doc["pemMaxValue"] = config.pemMaxValue;
-  doc["pemStepSize"] = config.pemStepSize;
+  doc["stepDelay"] = c.stepDelayMs;
+  doc["pemMaxValue"] = c.pemMaxValue;
+  doc["pemStepSize"] = c.pemStepSize;
+  doc["streamRate"] = config.streamRate;
+  doc["h2DebounceMs"] = config.h2DebounceMs;
+  doc["h2GlitchUs"] = config.h2GlitchUs;
+  doc["levelFilter"] = c.levelFilter;
+  doc["levelNoise"] = c.levelNoise;
+  doc["rateNoise"] = c.rateNoise;
+  doc["lowLevelLookahead"] = c.lowLevelLookahead;
+  JsonArray points = doc.createNestedArray("calibration");
+  for (int i = 0; i < c.calibrationCount; i++) {
+    JsonObject point = points.createNestedObject();
+    point["resistance"] = c.calibration[i].resistance;
+    point["duty"] = c.calibration[i].duty;
+  }
   doc["wifiSSID"] = config.wifiSSID;
   doc["wifiPassword"] = ""; // Don't send the password to the client
   
@@ -0,0 +1,85 @@
+#ifndef HAL_H
+#define HAL_H
+
+#include <stdint.h>
+#include "datalog.h"
+
+// Thin hardware abstraction used by the control logic in control.cpp.
+// hal_esp32.cpp implements it on the board; sim/hal_sim.cpp implements it
+// against a simulated tank for host builds.
+
+// Pin Definitions (channel 0)
+#define MOSFET_PWM_PIN 25   // Controls gauge needle
+#define BACKLIGHT_PIN 26    // Blinks when level is low
+#define PS_CONTROL_PIN 27    // 0-5V control for power supply
+#define FLOAT_SENSOR_PIN 34  // Reads float sensor voltage
+#define H2_SIGNAL_PIN 35     // Input from H2 board coil plug (12V)
+#define I2C_SDA_PIN 21        // I2C Data (reserved for future use)
+#define I2C_SCL_PIN 22        // I2C Clock (reserved for future use)
+#define watch_dog 33          // 10ms
+
+// Pins of every channel. Float sensors must be on ADC1 (ADC2 is unusable
+// while WiFi runs), which is what limits MAX_CHANNELS.
+struct ChannelPins {
+  uint8_t gauge;
+  uint8_t backlight;
+  uint8_t psControl;
+  uint8_t floatSensor;
+  uint8_t h2Signal;
+};
+
+static const ChannelPins channelPins[] = {
+  {MOSFET_PWM_PIN, BACKLIGHT_PIN, PS_CONTROL_PIN, FLOAT_SENSOR_PIN, H2_SIGNAL_PIN},
+  {16, 18, 17, 36, 13},
+  {19, 5, 23, 39, 14},
+};
+
+// Configure PWM outputs, GPIO and sensor sampling for channelCount channels
+void halBegin();
+
+unsigned long halMillis();
+
+// Microseconds since startup
+unsigned long halMicros();
+
+// Free-running cycle counter for profiling, and its rate
+uint32_t halCycles();
+uint32_t halCyclesPerMicrosecond();
+
+// 8-bit duty for a channel's gauge MOSFET and power supply control output
+void halSetGaugeDuty(int ch, int duty);
+void halSetPsDuty(int ch, int duty);
+
+// Debounced H2 input: on once the pin has been high for h2DebounceMs, off
+// as soon as the edge interrupt confirms a drop (or, if an edge was missed,
+// once the pin has read low for longer than h2GlitchUs)
+bool halReadH2Signal(int ch);
+
+// True once per H2 drop the edge interrupt acted on, with the time from
+// entering the interrupt to the PS output at 0 in halCycles() units (the
+// worst one if several drops were not yet taken). The interrupt dispatch
+// delay before entry is not included. Until it is taken, halSetPsDuty()
+// holds the channel's PS at 0.
+bool halTakeH2Cutoff(int ch, uint32_t *isrCycles);
+
+// Latest filtered float sensor voltage of a channel in mV (never blocks)
+uint32_t halReadSensorMillivolts(int ch);
+
+// False until the sampler has produced the channel's first reading; before
+// that halReadSensorMillivolts() returns 0
+bool halSensorReady(int ch);
+
+void halSetBacklight(int ch, bool on);
+void halToggleWatchdog();
+
+// Queue a message for the serial monitor without blocking; dropped if the
+// queue is full. Only the pointer is kept, so pass a string literal.
+void halLog(const char *message);
+
+// Print the messages queued by halLog(); called by the service task
+void halPrintLog();
+
+// Hand a sample to the data log without blocking; false if it was dropped
+bool halLogRecord(const LogRecord &record);
+
+#endif
@@ -0,0 +1,455 @@
+#include <Arduino.h>
+#include "driver/ledc.h"  // Required for ESP32 Core v3.0.0+
+#include "driver/adc.h"
+#include "driver/gpio.h"
+#include "esp_adc_cal.h"
+#include "esp_timer.h"
+#include "hal/cpu_hal.h"
+#include "hal/gpio_ll.h"
+#include "hal/ledc_ll.h"
+#include "hal.h"
+#include "control.h"
+#include "adcfilter.h"
+#include "datalog_esp32.h"
+
+// ESP32 implementation of hal.h
+
+// PWM Configuration
+#define PWM_FREQUENCY 5000  // PWM frequency in Hz
+#define PWM_RESOLUTION LEDC_TIMER_8_BIT  // 8-bit for gauge control
+#define PWM_TIMER LEDC_TIMER_0          // Shared by every channel's gauge output
+
+// PWM Configuration for Power Supply Control
+#define PS_PWM_FREQ 10000
+#define PS_PWM_RES LEDC_TIMER_8_BIT
+#define PS_PWM_TIMER LEDC_TIMER_1       // Shared by every channel's PS output
+
+// Each channel gets its own pair of LEDC channels: gauge, then PS
+#define PWM_CHANNEL(ch) ((ledc_channel_t)(LEDC_CHANNEL_0 + 2 * (ch)))
+#define PS_PWM_CHANNEL(ch) ((ledc_channel_t)(LEDC_CHANNEL_0 + 2 * (ch) + 1))
+
+static_assert(sizeof(channelPins) / sizeof(channelPins[0]) == MAX_CHANNELS, "one pin set per channel");
+static_assert(2 * MAX_CHANNELS <= LEDC_CHANNEL_MAX, "two LEDC channels per channel");
+
+// Continuous (I2S DMA) ADC sampling of the float sensors. The DMA pattern
+// cycles through every channel's input; adcTask decimates each one into a
+// ring of numSamples values and publishes filtered voltages the control task
+// reads without waiting.
+#define ADC_SAMPLE_RATE_HZ 20000     // DMA conversion rate (lowest the ESP32 supports)
+#define ADC_DMA_FRAME_SAMPLES 256    // Conversions per DMA frame
+#define ADC_OVERSAMPLE 20            // Conversions averaged into one window sample (1 kHz / channels)
+#define ADC_DEFAULT_VREF_MV 1100     // Only used if the eFuse holds no calibration
+#define ADC_TASK_CORE 0
+#define ADC_TASK_PRIORITY 5
+#define ADC_TASK_STACK 4096
+
+// halLog() messages waiting for the service task
+#define LOG_MESSAGE_QUEUE_LENGTH 16
+
+// Per-channel decimation and filter state
+struct AdcInput {
+  uint32_t accumulator;
+  int accumulated;
+  uint16_t window[ADC_WINDOW_MAX];
+  int windowHead;
+  int windowCount;
+};
+
+static esp_adc_cal_characteristics_t adcChars;
+static AdcInput adcInputs[MAX_CHANNELS];
+static int8_t adcChannelMap[ADC1_CHANNEL_MAX];       // ADC1 channel -> our channel, -1 if unused
+static volatile uint32_t adcFilteredMv[MAX_CHANNELS];  // Latest filtered sensor voltage in mV
+static volatile bool adcReady[MAX_CHANNELS];           // adcFilteredMv holds a real reading
+static TaskHandle_t adcTaskHandle = NULL;
+
+static QueueHandle_t logMessages = NULL;
+static volatile uint32_t droppedLogMessages = 0;
+
+static void initAdcSampler();
+static void adcTask(void *param);
+static void pushAdcSample(AdcInput &input, uint16_t raw);
+
+// H2 inputs are watched by a GPIO interrupt on both edges. The handler and
+// everything it touches live in IRAM/DRAM so it also runs while the data
+// log is writing flash. It runs on the core that called halBegin(), the
+// control core, so it never overlaps the control task's output writes.
+struct H2Input {
+  gpio_num_t pin;
+  ledc_channel_t psChannel;
+  bool debounced;              // Level reported by halReadH2Signal()
+  bool psDriven;               // Last duty written by halSetPsDuty() was non-zero
+  int64_t lastEdgeUs;          // Last edge seen by the interrupt, or by polling
+  bool polledLevel;            // Pin level at the last poll, polling mode only
+  bool cutoff;                 // PS output cut, not yet taken by the control task
+  uint32_t isrCycles;          // Interrupt entry to output of that cut
+};
+
+static H2Input h2Inputs[MAX_CHANNELS];
+static portMUX_TYPE h2Mux = portMUX_INITIALIZER_UNLOCKED;
+static uint32_t h2CyclesPerUs = 240;
+static bool h2Polling = false;  // No edge interrupt, halReadH2Signal() sees the edges
+
+static void initH2Inputs();
+static void pollH2Edges(H2Input &input);
+static void IRAM_ATTR h2EdgeIsr(void *arg);
+
+void halBegin() {
+    logMessages = xQueueCreate(LOG_MESSAGE_QUEUE_LENGTH, sizeof(const char *));
+
+    // Configure PWM timers for Gauge and Power Supply Control
+    ledc_timer_config_t timerConfig = {
+        .speed_mode = LEDC_LOW_SPEED_MODE,
+        .duty_resolution = PWM_RESOLUTION,
+        .timer_num = PWM_TIMER,
+        .freq_hz = PWM_FREQUENCY,
+        .clk_cfg = LEDC_AUTO_CLK
+    };
+    ledc_timer_config(&timerConfig);
+
+    ledc_timer_config_t psTimerConfig = {
+        .speed_mode = LEDC_LOW_SPEED_MODE,
+        .duty_resolution = PS_PWM_RES,
+        .timer_num = PS_PWM_TIMER,
+        .freq_hz = PS_PWM_FREQ,
+        .clk_cfg = LEDC_AUTO_CLK
+    };
+    ledc_timer_config(&psTimerConfig);
+
+    for (int ch = 0; ch < channelCount; ch++) {
+        const ChannelPins &pins = channelPins[ch];
+
+        ledc_channel_config_t channelConfig = {
+            .gpio_num = pins.gauge,
+            .speed_mode = LEDC_LOW_SPEED_MODE,
+            .channel = PWM_CHANNEL(ch),
+            .intr_type = LEDC_INTR_DISABLE,
+            .timer_sel = PWM_TIMER,
+            .duty = 0, // Initial duty cycle
+            .hpoint = 0
+        };
+        ledc_channel_config(&channelConfig);
+
+        ledc_channel_config_t psChannelConfig = {
+            .gpio_num = pins.psControl,
+            .speed_mode = LEDC_LOW_SPEED_MODE,
+            .channel = PS_PWM_CHANNEL(ch),
+            .intr_type = LEDC_INTR_DISABLE,
+            .timer_sel = PS_PWM_TIMER,
+            .duty = 0,
+            .hpoint = 0
+        };
+        ledc_channel_config(&psChannelConfig);
+
+        // Setup Pins
+        pinMode(pins.backlight, OUTPUT);
+        pinMode(pins.h2Signal, INPUT_PULLDOWN);
+        digitalWrite(pins.backlight, LOW);
+
+        // Initialize power supply control to 0V
+        halSetPsDuty(ch, 0);
+    }
+
+    // Watch the H2 inputs for edges
+    initH2Inputs();
+
+    // Start background sampling of the float sensors
+    initAdcSampler();
+}
+
+unsigned long halMillis() {
+    return millis();
+}
+
+unsigned long halMicros() {
+    return micros();
+}
+
+uint32_t halCycles() {
+    return ESP.getCycleCount();
+}
+
+uint32_t halCyclesPerMicrosecond() {
+    return ESP.getCpuFreqMHz();
+}
+
+void halSetGaugeDuty(int ch, int duty) {
+    ledc_set_duty(LEDC_LOW_SPEED_MODE, PWM_CHANNEL(ch), duty);
+    ledc_update_duty(LEDC_LOW_SPEED_MODE, PWM_CHANNEL(ch));
+}
+
+void halSetPsDuty(int ch, int duty) {
+    // Checked and written as one step so a cut from the edge interrupt is
+    // never overwritten before the control task has seen it
+    portENTER_CRITICAL(&h2Mux);
+    if (h2Inputs[ch].cutoff) duty = 0;
+    h2Inputs[ch].psDriven = (duty != 0);
+    ledc_set_duty(LEDC_LOW_SPEED_MODE, PS_PWM_CHANNEL(ch), duty);
+    ledc_update_duty(LEDC_LOW_SPEED_MODE, PS_PWM_CHANNEL(ch));
+    portEXIT_CRITICAL(&h2Mux);
+}
+
+bool halReadH2Signal(int ch) {
+    H2Input &input = h2Inputs[ch];
+    if (h2Polling) pollH2Edges(input);
+
+    portENTER_CRITICAL(&h2Mux);
+    bool high = gpio_ll_get_level(&GPIO, input.pin);
+    int64_t stableUs = esp_timer_get_time() - input.lastEdgeUs;
+    if (high && !input.debounced && stableUs >= h2DebounceMs * 1000LL) {
+        input.debounced = true;
+    } else if (!high && input.debounced && stableUs > h2GlitchUs) {
+        input.debounced = false;  // Drop without an edge interrupt
+    }
+    bool level = input.debounced;
+    portEXIT_CRITICAL(&h2Mux);
+    return level;
+}
+
+bool halTakeH2Cutoff(int ch, uint32_t *isrCycles) {
+    H2Input &input = h2Inputs[ch];
+    portENTER_CRITICAL(&h2Mux);
+    bool cutoff = input.cutoff;
+    *isrCycles = input.isrCycles;
+    input.cutoff = false;
+    portEXIT_CRITICAL(&h2Mux);
+    return cutoff;
+}
+
+uint32_t halReadSensorMillivolts(int ch) {
+    return adcFilteredMv[ch];
+}
+
+bool halSensorReady(int ch) {
+    return adcReady[ch];
+}
+
+void halSetBacklight(int ch, bool on) {
+    digitalWrite(channelPins[ch].backlight, on ? HIGH : LOW);
+}
+
+void halToggleWatchdog() {
+    digitalWrite(watch_dog, !digitalRead(watch_dog)); // Toggle
+}
+
+// The control task must not wait on the UART: Serial.println() takes the
+// port mutex and blocks until the bytes fit in the FIFO, which can take
+// longer than a control period. Only the pointer is queued.
+void halLog(const char *message) {
+    if (logMessages == NULL) {
+        Serial.println(message);  // Before halBegin(), from setup()
+    } else if (xQueueSend(logMessages, &message, 0) != pdTRUE) {
+        droppedLogMessages = droppedLogMessages + 1;
+    }
+}
+
+void halPrintLog() {
+    static uint32_t reportedDrops = 0;
+    const char *message;
+    while (logMessages != NULL && xQueueReceive(logMessages, &message, 0) == pdTRUE) {
+        Serial.println(message);
+    }
+    uint32_t drops = droppedLogMessages;
+    if (drops != reportedDrops) {
+        Serial.printf("(%lu log messages dropped)\n", (unsigned long)(drops - reportedDrops));
+        reportedDrops = drops;
+    }
+}
+
+bool halLogRecord(const LogRecord &record) {
+    return dataLogPush(record);
+}
+
+// Attach the edge interrupt to every channel's H2 input
+static void initH2Inputs() {
+    h2CyclesPerUs = ESP.getCpuFreqMHz();
+    for (int ch = 0; ch < MAX_CHANNELS; ch++) {
+        h2Inputs[ch].pin = (gpio_num_t)channelPins[ch].h2Signal;
+        h2Inputs[ch].psChannel = PS_PWM_CHANNEL(ch);
+        h2Inputs[ch].lastEdgeUs = esp_timer_get_time();
+        h2Inputs[ch].polledLevel = gpio_ll_get_level(&GPIO, h2Inputs[ch].pin);
+    }
+
+    // Fails if something else installed the service without ESP_INTR_FLAG_IRAM
+    if (gpio_install_isr_service(ESP_INTR_FLAG_IRAM) != ESP_OK) {
+        Serial.println("H2 edge interrupt unavailable, polling only");
+        h2Polling = true;
+        return;
+    }
+
+    for (int ch = 0; ch < channelCount; ch++) {
+        gpio_num_t pin = h2Inputs[ch].pin;
+        gpio_set_intr_type(pin, GPIO_INTR_ANYEDGE);
+        gpio_isr_handler_add(pin, h2EdgeIsr, (void *)(intptr_t)ch);
+        gpio_intr_enable(pin);
+    }
+}
+
+// Polling mode stand-in for the edge interrupt, run from the control task.
+// A level change counts as an edge when it is first seen. A drop is
+// confirmed by polling for h2GlitchUs right away, as the interrupt does, so
+// the PS is cut in the same control step that first sees the pin low.
+static void pollH2Edges(H2Input &input) {
+    bool high = gpio_ll_get_level(&GPIO, input.pin);
+    if (high == input.polledLevel) return;
+
+    int64_t edgeUs = esp_timer_get_time();
+    input.polledLevel = high;
+    input.lastEdgeUs = edgeUs;
+    if (high || !input.debounced) return;
+
+    while (esp_timer_get_time() - edgeUs <= h2GlitchUs) {
+        if (gpio_ll_get_level(&GPIO, input.pin)) {
+            input.polledLevel = true;
+            input.lastEdgeUs = esp_timer_get_time();
+            return;
+        }
+    }
+}
+
+// Rising edges only restart the debounce time. A falling edge is confirmed
+// by polling the pin for h2GlitchUs; if it stays low the PS output is
+// forced low at the LEDC register level, without waiting for the end of
+// the PWM period, and the control task catches up on its next step.
+// Drops while H2 was not yet debounced on and the PS was off (noise during
+// the debounce time) have nothing to cut and are not latched.
+static void IRAM_ATTR h2EdgeIsr(void *arg) {
+    uint32_t entryCycles = cpu_hal_get_cycle_count();
+    H2Input &input = h2Inputs[(intptr_t)arg];
+
+    input.lastEdgeUs = esp_timer_get_time();
+    if (gpio_ll_get_level(&GPIO, input.pin)) return;
+
+    uint32_t glitchCycles = (uint32_t)h2GlitchUs * h2CyclesPerUs;
+    while (cpu_hal_get_cycle_count() - entryCycles < glitchCycles) {
+        if (gpio_ll_get_level(&GPIO, input.pin)) {
+            // Glitch; its rising edge arrived while polling, so record it here
+            input.lastEdgeUs = esp_timer_get_time();
+            return;
+        }
+    }
+
+    portENTER_CRITICAL_ISR(&h2Mux);
+    if (!input.debounced && !input.psDriven) {
+        portEXIT_CRITICAL_ISR(&h2Mux);
+        return;
+    }
+    ledc_ll_set_duty_int_part(&LEDC, LEDC_LOW_SPEED_MODE, input.psChannel, 0);
+    ledc_ll_set_idle_level(&LEDC, LEDC_LOW_SPEED_MODE, input.psChannel, 0);
+    ledc_ll_set_sig_out_en(&LEDC, LEDC_LOW_SPEED_MODE, input.psChannel, false);
+    ledc_ll_set_duty_start(&LEDC, LEDC_LOW_SPEED_MODE, input.psChannel, false);
+    ledc_ll_ls_channel_update(&LEDC, LEDC_LOW_SPEED_MODE, input.psChannel);
+
+    uint32_t isrCycles = cpu_hal_get_cycle_count() - entryCycles;
+    if (!input.cutoff || isrCycles > input.isrCycles) {
+        input.isrCycles = isrCycles;
+    }
+    input.cutoff = true;
+    input.debounced = false;
+    input.psDriven = false;
+    portEXIT_CRITICAL_ISR(&h2Mux);
+}
+
+// Configure ADC1 for continuous DMA conversion of every channel's float
+// sensor input and start adcTask
+static void initAdcSampler() {
+    static adc_digi_pattern_config_t patterns[MAX_CHANNELS];
+    uint32_t channelMask = 0;
+
+    memset(adcChannelMap, -1, sizeof(adcChannelMap));
+    for (int ch = 0; ch < channelCount; ch++) {
+        adc1_channel_t channel = (adc1_channel_t)digitalPinToAnalogChannel(channelPins[ch].floatSensor);
+        adcChannelMap[channel] = ch;
+        channelMask |= BIT(channel);
+
+        patterns[ch].atten = ADC_ATTEN_DB_11;
+        patterns[ch].channel = (uint8_t)channel;
+        patterns[ch].unit = 0;  // ADC1
+        patterns[ch].bit_width = SOC_ADC_DIGI_MAX_BITWIDTH;
+    }
+
+    // Per-chip calibration (eFuse Vref or two-point values) for raw -> mV
+    esp_adc_cal_value_t calSource = esp_adc_cal_characterize(ADC_UNIT_1, ADC_ATTEN_DB_11,
+                                                             ADC_WIDTH_BIT_12, ADC_DEFAULT_VREF_MV, &adcChars);
+    Serial.print("ADC calibration: ");
+    Serial.println(calSource == ESP_ADC_CAL_VAL_EFUSE_TP ? "eFuse two-point" :
+                   calSource == ESP_ADC_CAL_VAL_EFUSE_VREF ? "eFuse Vref" : "default Vref");
+
+    adc_digi_init_config_t dmaConfig = {
+        .max_store_buf_size = ADC_DMA_FRAME_SAMPLES * SOC_ADC_DIGI_RESULT_BYTES * 4,
+        .conv_num_each_intr = ADC_DMA_FRAME_SAMPLES * SOC_ADC_DIGI_RESULT_BYTES,
+        .adc1_chan_mask = channelMask,
+        .adc2_chan_mask = 0,
+    };
+    adc_digi_initialize(&dmaConfig);
+
+    adc_digi_configuration_t digiConfig = {
+        .conv_limit_en = 1,
+        .conv_limit_num = 250,
+        .pattern_num = (uint32_t)channelCount,
+        .adc_pattern = patterns,
+        .sample_freq_hz = ADC_SAMPLE_RATE_HZ,
+        .conv_mode = ADC_CONV_SINGLE_UNIT_1,
+        .format = ADC_DIGI_OUTPUT_FORMAT_TYPE1,
+    };
+    adc_digi_controller_configure(&digiConfig);
+    adc_digi_start();
+
+    xTaskCreatePinnedToCore(adcTask, "adc", ADC_TASK_STACK, NULL,
+                            ADC_TASK_PRIORITY, &adcTaskHandle, ADC_TASK_CORE);
+}
+
+// Drain DMA frames, sort conversions by channel, decimate by ADC_OVERSAMPLE
+// and refresh adcFilteredMv
+static void adcTask(void *param) {
+    static uint8_t frame[ADC_DMA_FRAME_SAMPLES * SOC_ADC_DIGI_RESULT_BYTES];
+
+    for (;;) {
+        uint32_t length = 0;
+        esp_err_t err = adc_digi_read_bytes(frame, sizeof(frame), &length, ADC_MAX_DELAY);
+        // ESP_ERR_INVALID_STATE only reports a driver-side overflow; the data is still valid
+        if (err != ESP_OK && err != ESP_ERR_INVALID_STATE) continue;
+
+        for (uint32_t i = 0; i + SOC_ADC_DIGI_RESULT_BYTES <= length; i += SOC_ADC_DIGI_RESULT_BYTES) {
+            adc_digi_output_data_t *result = (adc_digi_output_data_t *)&frame[i];
+            if (result->type1.channel >= ADC1_CHANNEL_MAX) continue;
+            int ch = adcChannelMap[result->type1.channel];
+            if (ch < 0) continue;
+
+            AdcInput &input = adcInputs[ch];
+            input.accumulator += result->type1.data;
+            if (++input.accumulated == ADC_OVERSAMPLE) {
+                pushAdcSample(input, input.accumulator / ADC_OVERSAMPLE);
+                input.accumulator = 0;
+                input.accumulated = 0;
+            }
+        }
+
+        for (int ch = 0; ch < channelCount; ch++) {
+            const AdcInput &input = adcInputs[ch];
+            if (input.windowCount > 0) {
+                uint32_t raw = filterAdcWindow(input.window, input.windowCount, ADC_FILTER_MODE);
+                adcFilteredMv[ch] = esp_adc_cal_raw_to_voltage(raw, &adcChars);
+                if (!adcReady[ch]) {
+                    __sync_synchronize();
+                    adcReady[ch] = true;
+                }
+            }
+        }
+    }
+}
+
+static void pushAdcSample(AdcInput &input, uint16_t raw) {
+    int windowSize = constrain(numSamples, 1, ADC_WINDOW_MAX);
+
+    if (input.windowCount > windowSize || input.windowHead >= windowSize) {
+        // numSamples was reduced at runtime; start the window over
+        input.windowHead = 0;
+        input.windowCount = 0;
+    }
+
+    input.window[input.windowHead] = raw;
+    input.windowHead = (input.windowHead + 1) % windowSize;
+    if (input.windowCount < windowSize) {
+        input.windowCount++;
+    }
+}
@@ -0,0 +1,90 @@
+#ifndef LEVELESTIMATOR_H
+#define LEVELESTIMATOR_H
+
+#include <math.h>
+
+// Two-state Kalman filter on the gauge duty read from the sensor table.
+//
+// State: level (duty) and drain rate at full power supply drive (duty/s,
+// negative while drawing). The level is predicted to move by rate * drive,
+// where drive is the PS duty / 255, so the rate is only learned and applied
+// while the PEM is drawing and is remembered between runs. While idle the
+// level is allowed to wander faster so a refill is followed; while drawing
+// it is held tight so slosh is rejected, unless the innovation stays biased
+// to one side (a refill while running), which slosh does not do.
+
+#define LEVEL_FILTER_EMA 0       // Legacy fixed exponential smoothing
+#define LEVEL_FILTER_KALMAN 1
+
+#define DEFAULT_LEVEL_FILTER LEVEL_FILTER_KALMAN
+#define DEFAULT_LEVEL_NOISE 2.0f       // Sender noise + slosh, std dev in duty
+#define DEFAULT_RATE_NOISE 0.02f       // Drain rate random walk, duty/s per sqrt(s)
+#define DEFAULT_LOW_LEVEL_LOOKAHEAD 5  // Seconds of predicted drain the cutoff looks ahead
+
+#define LEVEL_DRIFT_DRAWING 0.01f    // Level random walk while drawing, duty^2/s
+#define LEVEL_DRIFT_IDLE 1.0f        // Level random walk while idle or off-model, duty^2/s
+#define LEVEL_RATE_INIT_VAR 0.25f    // Initial drain rate variance, (duty/s)^2
+#define LEVEL_BIAS_TAU 2.0f          // Averaging time of the innovation bias detector, s
+#define LEVEL_BIAS_LIMIT 0.3f        // Mean innovation, in duty, treated as off-model
+
+struct LevelEstimator {
+  float level;      // Duty
+  float rate;       // Duty/s at full PS drive
+  float p00, p01, p11;
+  float bias;       // Low-passed innovation
+  bool seeded;
+};
+
+inline void estimatorReset(LevelEstimator &e) {
+  e = LevelEstimator();
+}
+
+// One predict/update step. measurement is the table duty, drive the PS duty
+// as a fraction (0..1), noise the measurement std dev in duty.
+inline void estimatorUpdate(LevelEstimator &e, float measurement, float drive, float dt,
+                            float noise, float rateNoise) {
+  float r = noise * noise;
+
+  if (!e.seeded) {
+    e.level = measurement;
+    e.p00 = r;
+    e.p01 = 0;
+    e.p11 = LEVEL_RATE_INIT_VAR;
+    e.bias = 0;
+    e.seeded = true;
+    return;
+  }
+
+  // Predict: level += rate * drive * dt
+  bool onModel = drive > 0 && fabsf(e.bias) < LEVEL_BIAS_LIMIT;
+  float g = drive * dt;
+  e.level += e.rate * g;
+  e.p00 += g * (2 * e.p01 + g * e.p11) + (onModel ? LEVEL_DRIFT_DRAWING : LEVEL_DRIFT_IDLE) * dt;
+  e.p01 += g * e.p11;
+  if (drive > 0) e.p11 += rateNoise * rateNoise * dt;
+
+  float innovation = measurement - e.level;
+  float s = e.p00 + r;
+  e.bias += (innovation - e.bias) * (dt / LEVEL_BIAS_TAU);
+
+  // Update
+  float k0 = e.p00 / s;
+  float k1 = e.p01 / s;
+  e.level += k0 * innovation;
+  e.rate += k1 * innovation;
+  if (e.rate > 0) e.rate = 0;  // Drawing never fills the tank
+  e.p11 -= k1 * e.p01;
+  e.p01 -= k0 * e.p01;
+  e.p00 -= k0 * e.p00;
+}
+
+// Seconds until the level reaches threshold at the current drain, or -1
+// when it is not draining
+inline float estimatorTimeToLevel(const LevelEstimator &e, float drive, float threshold) {
+  float slope = e.rate * drive;
+  if (!e.seeded || slope > -1e-3f) return -1;
+  float t = (e.level - threshold) / -slope;
+  return t > 0 ? t : 0;
+}
+
+#endif
@@ -0,0 +1,179 @@
+#include <stdio.h>
+#include <string.h>
+#include "metrics.h"
+#include "control.h"
+#include "hal.h"
+
+// Written from the control task (control stages), the web/service tasks
+// (HTTP, telemetry) and the data log task (page writes). Each stage has a
+// single writer; /metrics readers may see a sample half-applied, which is
+// acceptable for statistics.
+static MetricStats stages[METRIC_STAGE_COUNT];
+
+static const char *stageNames[METRIC_STAGE_COUNT] = {
+  "control_step",
+  "adc_read",
+  "resistance",
+  "smoothing",
+  "gauge_update",
+  "pem",
+  "safety",
+  "control_period",
+  "telemetry",
+  "http",
+  "log_write",
+  "h2_isr",
+};
+
+static uint32_t lastStepStart = 0;
+static bool haveStepStart = false;
+static uint32_t missedDeadlines = 0;
+
+static volatile unsigned long bootMilestoneUs[BOOT_MILESTONE_COUNT];
+
+static const char *bootMilestoneNames[BOOT_MILESTONE_COUNT] = {
+  "boot_first_actuation_ms",
+  "boot_network_ready_ms",
+};
+
+static unsigned long lastWatchdogToggle = 0;
+static uint32_t watchdogToggles = 0;
+static unsigned long watchdogMaxGapMs = 0;
+static uint32_t watchdogLateToggles = 0;
+
+static int bucketFor(uint32_t value) {
+    if (value < 4) return value;
+    int msb = 31 - __builtin_clz(value);
+    int sub = (value >> (msb - 2)) & 3;
+    return (msb - 1) * 4 + sub;
+}
+
+// Smallest value that falls in the bucket after index
+static uint32_t bucketUpperBound(int index) {
+    index++;
+    if (index < 4) return index;
+    if (index >= METRICS_BUCKETS) return UINT32_MAX;
+    int msb = index / 4 + 1;
+    int sub = index % 4;
+    return (uint32_t)(4 + sub) << (msb - 2);
+}
+
+void metricsRecord(MetricStage stage, uint32_t cycles) {
+    MetricStats &stats = stages[stage];
+    if (stats.count == 0 || cycles < stats.min) stats.min = cycles;
+    if (cycles > stats.max) stats.max = cycles;
+    stats.total += cycles;
+    stats.buckets[bucketFor(cycles)]++;
+    stats.count++;
+}
+
+void metricsControlStepStart(uint32_t cycles) {
+    if (haveStepStart) {
+        uint32_t period = cycles - lastStepStart;
+        metricsRecord(METRIC_CONTROL_PERIOD, period);
+
+        uint32_t nominal = CONTROL_PERIOD_MS * 1000 * halCyclesPerMicrosecond();
+        if (period > nominal * MISSED_DEADLINE_FACTOR) {
+            missedDeadlines++;
+        }
+    }
+    lastStepStart = cycles;
+    haveStepStart = true;
+}
+
+void metricsWatchdogToggle(unsigned long millis) {
+    if (watchdogToggles > 0) {
+        unsigned long gap = millis - lastWatchdogToggle;
+        if (gap > watchdogMaxGapMs) watchdogMaxGapMs = gap;
+        // The control rate limits toggle precision to one control period
+        if (gap > WATCHDOG_INTERVAL + CONTROL_PERIOD_MS) watchdogLateToggles++;
+    }
+    lastWatchdogToggle = millis;
+    watchdogToggles++;
+}
+
+uint32_t metricsPercentile(const MetricStats &stats, int percentile) {
+    if (stats.count == 0) return 0;
+
+    uint64_t target = ((uint64_t)stats.count * percentile + 99) / 100;
+    uint64_t seen = 0;
+    for (int i = 0; i < METRICS_BUCKETS; i++) {
+        seen += stats.buckets[i];
+        if (seen >= target) {
+            uint32_t bound = bucketUpperBound(i);
+            return bound < stats.max ? bound : stats.max;
+        }
+    }
+    return stats.max;
+}
+
+void metricsBootMilestone(BootMilestone milestone) {
+    if (bootMilestoneUs[milestone] == 0) {
+        unsigned long now = halMicros();
+        bootMilestoneUs[milestone] = now ? now : 1;
+    }
+}
+
+unsigned long metricsBootMilestoneUs(BootMilestone milestone) {
+    return bootMilestoneUs[milestone];
+}
+
+const MetricStats &metricsStage(MetricStage stage) {
+    return stages[stage];
+}
+
+void metricsReset() {
+    memset(stages, 0, sizeof(stages));
+    haveStepStart = false;
+    missedDeadlines = 0;
+    watchdogToggles = 0;
+    watchdogMaxGapMs = 0;
+    watchdogLateToggles = 0;
+}
+
+size_t metricsFormat(char *buffer, size_t size) {
+    float cyclesPerUs = halCyclesPerMicrosecond();
+    size_t length = 0;
+
+    length += snprintf(buffer + length, size - length, "# stage count min_us avg_us p99_us max_us\n");
+
+    for (int i = 0; i < METRIC_STAGE_COUNT && length < size; i++) {
+        const MetricStats &stats = stages[i];
+        float avg = stats.count ? (float)stats.total / stats.count : 0;
+        length += snprintf(buffer + length, size - length, "%s %lu %.1f %.1f %.1f %.1f\n",
+                           stageNames[i], (unsigned long)stats.count,
+                           stats.min / cyclesPerUs, avg / cyclesPerUs,
+                           metricsPercentile(stats, 99) / cyclesPerUs, stats.max / cyclesPerUs);
+    }
+
+    if (length < size) {
+        const MetricStats &period = stages[METRIC_CONTROL_PERIOD];
+        length += snprintf(buffer + length, size - length,
+                           "control_rate_hz %d\n"
+                           "control_jitter_us %.1f\n"
+                           "missed_deadlines %lu\n"
+                           "watchdog_toggles %lu\n"
+                           "watchdog_max_gap_ms %lu\n"
+                           "watchdog_late_toggles %lu\n",
+                           CONTROL_RATE_HZ,
+                           period.count ? (period.max - period.min) / cyclesPerUs : 0,
+                           (unsigned long)missedDeadlines,
+                           (unsigned long)watchdogToggles,
+                           watchdogMaxGapMs,
+                           (unsigned long)watchdogLateToggles);
+    }
+
+    for (int i = 0; i < BOOT_MILESTONE_COUNT && length < size; i++) {
+        length += snprintf(buffer + length, size - length, "%s %.1f\n",
+                           bootMilestoneNames[i], bootMilestoneUs[i] / 1000.0);
+    }
+
+    return length < size ? length : size - 1;
+}
+
+ScopedMetric::ScopedMetric(MetricStage stage) : stage(stage), start(halCycles()) {
+}
+
+ScopedMetric::~ScopedMetric() {
+    metricsRecord(stage, halCycles() - start);
+}
@@ -0,0 +1,82 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Cycle-counter timing of the control stages and web handlers, kept as
+// log-scaled histograms (4 sub-buckets per power of two, ~19% resolution)
+// so min/avg/max/p99 can be reported without storing samples.
+
+enum MetricStage {
+  METRIC_CONTROL_STEP,    // Whole controlStep()
+  METRIC_ADC_READ,
+  METRIC_RESISTANCE,
+  METRIC_SMOOTHING,
+  METRIC_GAUGE_UPDATE,
+  METRIC_PEM,
+  METRIC_SAFETY,
+  METRIC_CONTROL_PERIOD,  // Start-to-start interval of controlStep()
+  METRIC_TELEMETRY,       // Serial debug output
+  METRIC_HTTP,            // AsyncWebServer handlers
+  METRIC_LOG_WRITE,       // Data log page write (flash cache off on both cores)
+  METRIC_H2_ISR,          // H2 edge interrupt entry to PS output at 0
+  METRIC_STAGE_COUNT
+};
+
+// Points in the boot sequence, timed from reset
+enum BootMilestone {
+  BOOT_FIRST_ACTUATION,   // First gauge/PS output written by the control task
+  BOOT_NETWORK_READY,     // Station got an IP or the fallback AP is up
+  BOOT_MILESTONE_COUNT
+};
+
+#define METRICS_BUCKETS 124
+#define MISSED_DEADLINE_FACTOR 1.5   // Period overrun counted as a missed deadline
+
+struct MetricStats {
+  uint32_t count;
+  uint32_t min;
+  uint32_t max;
+  uint64_t total;
+  uint32_t buckets[METRICS_BUCKETS];
+};
+
+void metricsRecord(MetricStage stage, uint32_t cycles);
+
+// Called at the top of every control step with the current cycle count;
+// records the period and counts missed deadlines
+void metricsControlStepStart(uint32_t cycles);
+
+// Called on every watchdog toggle
+void metricsWatchdogToggle(unsigned long millis);
+
+// Percentile (0-100) of a stage in cycles, bucket upper bound
+uint32_t metricsPercentile(const MetricStats &stats, int percentile);
+
+const MetricStats &metricsStage(MetricStage stage);
+
+// Record a boot milestone once; later calls are ignored
+void metricsBootMilestone(BootMilestone milestone);
+
+// Microseconds from reset to the milestone, 0 if not reached yet
+unsigned long metricsBootMilestoneUs(BootMilestone milestone);
+
+// Clears stage timings and counters; boot milestones are kept
+void metricsReset();
+
+// Compact text report for /metrics; returns the length written
+size_t metricsFormat(char *buffer, size_t size);
+
+// Times the enclosing scope into a stage
+class ScopedMetric {
+public:
+  explicit ScopedMetric(MetricStage stage);
+  ~ScopedMetric();
+
+private:
+  MetricStage stage;
+  uint32_t start;
+};
+
+#endif
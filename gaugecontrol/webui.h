@@ -1,353 +1,392 @@
-const char index_html[] PROGMEM = R"rawliteral(
-<!DOCTYPE html>
-<html lang="en">
-<head>
-    <meta charset="UTF-8">
-    <meta name="viewport" content="width=device-width, initial-scale=1.0">
-    <title>Gauge Control Configuration</title>
-    <script src="https://cdn.tailwindcss.com"></script>
-</head>
-<body class="bg-gray-100 font-sans leading-normal tracking-normal">
-    <div class="container mx-auto px-4 py-8">
-        <div class="bg-white shadow-md rounded px-8 pt-6 pb-8 mb-4">
-            <h1 class="text-2xl font-bold text-center text-gray-700 mb-6">Gauge Control Configuration</h1>
-            
-            <form id="configForm" class="space-y-6">
-                <div class="grid grid-cols-1 md:grid-cols-2 gap-6">
-                    <!-- Resistance Settings -->
-                    <div class="space-y-4">
-                        <h2 class="text-xl font-semibold text-gray-600">Resistance Settings</h2>
-                        
-                        <div>
-                            <label class="block text-gray-700 text-sm font-bold mb-2" for="maxResistance">
-                                Max Resistance (Empty Tank):
-                            </label>
-                            <div class="flex items-center">
-                                <input class="shadow appearance-none border rounded w-full py-2 px-3 text-gray-700 leading-tight focus:outline-none focus:shadow-outline" id="maxResistance" type="number" min="0" max="1000">
-                                <span class="ml-2 text-gray-600">Ohms</span>
-                            </div>
-                        </div>
-                        
-                        <div>
-                            <label class="block text-gray-700 text-sm font-bold mb-2" for="minResistance">
-                                Min Resistance (Full Tank):
-                            </label>
-                            <div class="flex items-center">
-                                <input class="shadow appearance-none border rounded w-full py-2 px-3 text-gray-700 leading-tight focus:outline-none focus:shadow-outline" id="minResistance" type="number" min="0" max="1000">
-                                <span class="ml-2 text-gray-600">Ohms</span>
-                            </div>
-                        </div>
-                        
-                        <div>
-                            <label class="block text-gray-700 text-sm font-bold mb-2" for="knownResistor">
-                                Known Resistor:
-                            </label>
-                            <div class="flex items-center">
-                                <input class="shadow appearance-none border rounded w-full py-2 px-3 text-gray-700 leading-tight focus:outline-none focus:shadow-outline" id="knownResistor" type="number" min="0" max="10000">
-                                <span class="ml-2 text-gray-600">Ohms</span>
-                            </div>
-                        </div>
-                    </div>
-                    
-                    <!-- PWM Settings -->
-                    <div class="space-y-4">
-                        <h2 class="text-xl font-semibold text-gray-600">PWM Settings</h2>
-                        
-                        <div>
-                            <label class="block text-gray-700 text-sm font-bold mb-2" for="minDuty">
-                                Min Duty (Empty):
-                            </label>
-                            <div class="flex items-center">
-                                <input class="shadow appearance-none border rounded w-full py-2 px-3 text-gray-700 leading-tight focus:outline-none focus:shadow-outline" id="minDuty" type="number" min="0" max="255">
-                            </div>
-                        </div>
-                        
-                        <div>
-                            <label class="block text-gray-700 text-sm font-bold mb-2" for="maxDuty">
-                                Max Duty (Full):
-                            </label>
-                            <div class="flex items-center">
-                                <input class="shadow appearance-none border rounded w-full py-2 px-3 text-gray-700 leading-tight focus:outline-none focus:shadow-outline" id="maxDuty" type="number" min="0" max="255">
-                            </div>
-                        </div>
-                        
-                        <div>
-                            <label class="block text-gray-700 text-sm font-bold mb-2" for="blinkThreshold">
-                                Blink Threshold:
-                            </label>
-                            <div class="flex items-center">
-                                <input class="shadow appearance-none border rounded w-full py-2 px-3 text-gray-700 leading-tight focus:outline-none focus:shadow-outline" id="blinkThreshold" type="number" min="0" max="255">
-                            </div>
-                        </div>
-                        
-                        <div>
-                            <label class="block text-gray-700 text-sm font-bold mb-2" for="lowLevelThreshold">
-                                Low Level Threshold:
-                            </label>
-                            <div class="flex items-center">
-                                <input class="shadow appearance-none border rounded w-full py-2 px-3 text-gray-700 leading-tight focus:outline-none focus:shadow-outline" id="lowLevelThreshold" type="number" min="0" max="255">
-                            </div>
-                        </div>
-                    </div>
-                </div>
-                
-                <!-- Timing Settings -->
-                <div class="space-y-4">
-                    <h2 class="text-xl font-semibold text-gray-600">Timing Settings</h2>
-                    <div class="grid grid-cols-1 md:grid-cols-3 gap-4">
-                        <div>
-                            <label class="block text-gray-700 text-sm font-bold mb-2" for="blinkInterval">
-                                Blink Interval:
-                            </label>
-                            <div class="flex items-center">
-                                <input class="shadow appearance-none border rounded w-full py-2 px-3 text-gray-700 leading-tight focus:outline-none focus:shadow-outline" id="blinkInterval" type="number" min="50" max="1000">
-                                <span class="ml-2 text-gray-600">ms</span>
-                            </div>
-                        </div>
-                        
-                        <div>
-                            <label class="block text-gray-700 text-sm font-bold mb-2" for="numSamples">
-                                ADC Samples:
-                            </label>
-                            <div class="flex items-center">
-                                <input class="shadow appearance-none border rounded w-full py-2 px-3 text-gray-700 leading-tight focus:outline-none focus:shadow-outline" id="numSamples" type="number" min="1" max="100">
-                            </div>
-                        </div>
-                        
-                        <div>
-                            <label class="block text-gray-700 text-sm font-bold mb-2" for="stepDelay">
-                                Step Delay:
-                            </label>
-                            <div class="flex items-center">
-                                <input class="shadow appearance-none border rounded w-full py-2 px-3 text-gray-700 leading-tight focus:outline-none focus:shadow-outline" id="stepDelay" type="number" min="1" max="100">
-                                <span class="ml-2 text-gray-600">ms</span>
-                            </div>
-                        </div>
-                    </div>
-                </div>
-                
-                <!-- PEM Startup Settings -->
-                <div class="space-y-4">
-                    <h2 class="text-xl font-semibold text-gray-600">PEM Startup Settings</h2>
-                    <div class="grid grid-cols-1 md:grid-cols-3 gap-4">
-                        <div>
-                            <label class="block text-gray-700 text-sm font-bold mb-2" for="pemMaxValue">
-                                Ramp Max Value:
-                            </label>
-                            <div class="flex items-center">
-                                <input class="shadow appearance-none border rounded w-full py-2 px-3 text-gray-700 leading-tight focus:outline-none focus:shadow-outline" id="pemMaxValue" type="number" min="0" max="255">
-                                <span class="ml-2 text-gray-600">0-255</span>
-                            </div>
-                        </div>
-                        
-                        <div>
-                            <label class="block text-gray-700 text-sm font-bold mb-2" for="pemStepSize">
-                                Ramp Step Size:
-                            </label>
-                            <div class="flex items-center">
-                                <input class="shadow appearance-none border rounded w-full py-2 px-3 text-gray-700 leading-tight focus:outline-none focus:shadow-outline" id="pemStepSize" type="number" min="1" max="50">
-                                <span class="ml-2 text-gray-600">per step</span>
-                            </div>
-                        </div>
-                        
-                        <div>
-                            <label class="block text-gray-700 text-sm font-bold mb-2" for="stepDelay">
-                                Step Delay:
-                            </label>
-                            <div class="flex items-center">
-                                <input class="shadow appearance-none border rounded w-full py-2 px-3 text-gray-700 leading-tight focus:outline-none focus:shadow-outline" id="stepDelay" type="number" min="1" max="100">
-                                <span class="ml-2 text-gray-600">ms</span>
-                            </div>
-                        </div>
-                    </div>
-                </div>
-                
-                <!-- WiFi Settings -->
-                <div class="space-y-4">
-                    <h2 class="text-xl font-semibold text-gray-600">WiFi Settings</h2>
-                    <div class="grid grid-cols-1 md:grid-cols-2 gap-4">
-                        <div>
-                            <label class="block text-gray-700 text-sm font-bold mb-2" for="wifiSSID">
-                                WiFi SSID:
-                            </label>
-                            <input class="shadow appearance-none border rounded w-full py-2 px-3 text-gray-700 leading-tight focus:outline-none focus:shadow-outline" id="wifiSSID" type="text">
-                        </div>
-                        
-                        <div>
-                            <label class="block text-gray-700 text-sm font-bold mb-2" for="wifiPassword">
-                                WiFi Password:
-                            </label>
-                            <input class="shadow appearance-none border rounded w-full py-2 px-3 text-gray-700 leading-tight focus:outline-none focus:shadow-outline" id="wifiPassword" type="password">
-                        </div>
-                    </div>
-                </div>
-                
-                <!-- Action Buttons -->
-                <div class="flex items-center justify-between pt-4">
-                    <button id="saveBtn" class="bg-blue-500 hover:bg-blue-700 text-white font-bold py-2 px-4 rounded focus:outline-none focus:shadow-outline" type="button">
-                        Save Configuration
-                    </button>
-                    <button id="resetBtn" class="bg-red-500 hover:bg-red-700 text-white font-bold py-2 px-4 rounded focus:outline-none focus:shadow-outline" type="button">
-                        Reset to Defaults
-                    </button>
-                </div>
-                
-                <div id="statusMessage" class="mt-4 text-center hidden"></div>
-            </form>
-            
-            <!-- Gauge Values Monitor -->
-            <div class="mt-8 pt-6 border-t border-gray-200">
-                <h2 class="text-xl font-semibold text-gray-600 mb-4">Live Monitor</h2>
-                <div id="liveData" class="grid grid-cols-2 md:grid-cols-4 gap-4 text-center">
-                    <div class="p-3 bg-gray-100 rounded shadow-inner">
-                        <div class="text-sm text-gray-600">Resistance</div>
-                        <div id="liveResistance" class="font-bold text-lg">-- Ω</div>
-                    </div>
-                    <div class="p-3 bg-gray-100 rounded shadow-inner">
-                        <div class="text-sm text-gray-600">Target Duty</div>
-                        <div id="liveTargetDuty" class="font-bold text-lg">--</div>
-                    </div>
-                    <div class="p-3 bg-gray-100 rounded shadow-inner">
-                        <div class="text-sm text-gray-600">Smoothed Duty</div>
-                        <div id="liveSmoothedDuty" class="font-bold text-lg">--</div>
-                    </div>
-                    <div class="p-3 bg-gray-100 rounded shadow-inner">
-                        <div class="text-sm text-gray-600">PEM Status</div>
-                        <div id="livePemStatus" class="font-bold text-lg">--</div>
-                    </div>
-                </div>
-            </div>
-        </div>
-    </div>
+// Generated by tools/build_webui.py from webui/ - do not edit.
+// 28726 bytes of HTML, 6139 bytes gzipped.
 
-    <script>
-        // Get current configuration
-        fetch('/config')
-            .then(response => response.json())
-            .then(config => {
-                document.getElementById('maxResistance').value = config.maxResistance;
-                document.getElementById('minResistance').value = config.minResistance;
-                document.getElementById('knownResistor').value = config.knownResistor;
-                document.getElementById('minDuty').value = config.minDuty;
-                document.getElementById('maxDuty').value = config.maxDuty;
-                document.getElementById('blinkThreshold').value = config.blinkThreshold;
-                document.getElementById('lowLevelThreshold').value = config.lowLevelThreshold;
-                document.getElementById('blinkInterval').value = config.blinkInterval;
-                document.getElementById('numSamples').value = config.numSamples;
-                document.getElementById('stepDelay').value = config.stepDelay;
-                document.getElementById('wifiSSID').value = config.wifiSSID || '';
-                document.getElementById('wifiPassword').value = config.wifiPassword || '';
-                document.getElementById('pemMaxValue').value = config.pemMaxValue;
-                document.getElementById('pemStepSize').value = config.pemStepSize;
-            })
-            .catch(error => {
-                console.error('Error fetching configuration:', error);
-                showStatus('Failed to load configuration', 'error');
-            });
+#define INDEX_HTML_ETAG "\"637bfce27fd7a90b\""
 
-        // Save configuration
-        document.getElementById('saveBtn').addEventListener('click', function() {
-            const config = {
-                maxResistance: parseInt(document.getElementById('maxResistance').value),
-                minResistance: parseInt(document.getElementById('minResistance').value),
-                knownResistor: parseInt(document.getElementById('knownResistor').value),
-                minDuty: parseInt(document.getElementById('minDuty').value),
-                maxDuty: parseInt(document.getElementById('maxDuty').value),
-                blinkThreshold: parseInt(document.getElementById('blinkThreshold').value),
-                lowLevelThreshold: parseInt(document.getElementById('lowLevelThreshold').value),
-                blinkInterval: parseInt(document.getElementById('blinkInterval').value),
-                numSamples: parseInt(document.getElementById('numSamples').value),
-                stepDelay: parseInt(document.getElementById('stepDelay').value),
-                wifiSSID: document.getElementById('wifiSSID').value,
-                wifiPassword: document.getElementById('wifiPassword').value,
-                pemMaxValue: parseInt(document.getElementById('pemMaxValue').value),
-                pemStepSize: parseInt(document.getElementById('pemStepSize').value)
-            };
-
-            fetch('/config', {
-                method: 'POST',
-                headers: {
-                    'Content-Type': 'application/json',
-                },
-                body: JSON.stringify(config),
-            })
-            .then(response => response.json())
-            .then(data => {
-                showStatus('Configuration saved successfully!', 'success');
-            })
-            .catch(error => {
-                console.error('Error saving configuration:', error);
-                showStatus('Failed to save configuration', 'error');
-            });
-        });
-
-        // Reset to defaults
-        document.getElementById('resetBtn').addEventListener('click', function() {
-            if (confirm('Are you sure you want to reset to default settings?')) {
-                fetch('/reset', { method: 'POST' })
-                    .then(response => response.json())
-                    .then(config => {
-                        document.getElementById('maxResistance').value = config.maxResistance;
-                        document.getElementById('minResistance').value = config.minResistance;
-                        document.getElementById('knownResistor').value = config.knownResistor;
-                        document.getElementById('minDuty').value = config.minDuty;
-                        document.getElementById('maxDuty').value = config.maxDuty;
-                        document.getElementById('blinkThreshold').value = config.blinkThreshold;
-                        document.getElementById('lowLevelThreshold').value = config.lowLevelThreshold;
-                        document.getElementById('blinkInterval').value = config.blinkInterval;
-                        document.getElementById('numSamples').value = config.numSamples;
-                        document.getElementById('stepDelay').value = config.stepDelay;
-                        document.getElementById('wifiSSID').value = config.wifiSSID || '';
-                        document.getElementById('wifiPassword').value = config.wifiPassword || '';
-                        document.getElementById('pemMaxValue').value = config.pemMaxValue;
-                        document.getElementById('pemStepSize').value = config.pemStepSize;
-                        
-                        showStatus('Reset to default values', 'success');
-                    })
-                    .catch(error => {
-                        console.error('Error resetting configuration:', error);
-                        showStatus('Failed to reset configuration', 'error');
-                    });
-            }
-        });
-
-        // Fetch live data every 2 seconds
-        setInterval(() => {
-            fetch('/livedata')
-                .then(response => response.json())
-                .then(data => {
-                    document.getElementById('liveResistance').textContent = data.resistance.toFixed(1) + ' Ω';
-                    document.getElementById('liveTargetDuty').textContent = data.targetDuty;
-                    document.getElementById('liveSmoothedDuty').textContent = data.smoothedDuty;
-                    document.getElementById('livePemStatus').textContent = data.pemRunning ? 'Running' : 'Stopped';
-                    
-                    // Add highlight class based on status
-                    document.getElementById('livePemStatus').className = 
-                        data.pemRunning ? 'font-bold text-lg text-green-600' : 'font-bold text-lg text-red-600';
-                })
-                .catch(error => {
-                    console.error('Error fetching live data:', error);
-                });
-        }, 2000);
-
-        function showStatus(message, type) {
-            const statusEl = document.getElementById('statusMessage');
-            statusEl.textContent = message;
-            statusEl.className = 'mt-4 text-center p-2 rounded';
-            
-            if (type === 'error') {
-                statusEl.classList.add('bg-red-100', 'text-red-700');
-            } else {
-                statusEl.classList.add('bg-green-100', 'text-green-700');
-            }
-            
-            statusEl.classList.remove('hidden');
-            
-            setTimeout(() => {
-                statusEl.classList.add('hidden');
-            }, 3000);
-        }
-    </script>
-</body>
-</html>
-)rawliteral"; 
\ No newline at end of file
+const size_t index_html_gz_len = 6139;
+const uint8_t index_html_gz[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x3d, 0xdb, 0x76, 0xe3, 0x36,
+  0x92, 0xef, 0xfe, 0x0a, 0x44, 0x39, 0x19, 0x51, 0x69, 0x49, 0x96, 0x68, 0x4b, 0xed, 0xc8, 0x97,
+  0x6c, 0xa7, 0xed, 0x4e, 0x7a, 0xa7, 0x6f, 0xa7, 0xed, 0x24, 0x3b, 0x9b, 0xcc, 0xc9, 0x81, 0x48,
+  0x48, 0xe2, 0x34, 0x45, 0x6a, 0x48, 0xc8, 0xb2, 0xa2, 0xf1, 0x07, 0xe5, 0x03, 0xf6, 0x07, 0xf6,
+  0x03, 0xf2, 0x4d, 0x5b, 0x85, 0x0b, 0x09, 0x90, 0xd4, 0xc5, 0x69, 0x7b, 0xd2, 0x3e, 0x67, 0xd3,
+  0xe9, 0x36, 0x89, 0x2a, 0x14, 0x0a, 0x05, 0xa0, 0x2e, 0x40, 0x81, 0x3e, 0xf9, 0xec, 0xfc, 0xed,
+  0xf3, 0xab, 0xbf, 0xbd, 0xbb, 0x20, 0x13, 0x3e, 0x0d, 0xcf, 0x4e, 0xf0, 0x5f, 0x12, 0xd2, 0x68,
+  0x7c, 0x5a, 0x63, 0x51, 0x0d, 0xde, 0x19, 0xf5, 0xcf, 0x4e, 0xa6, 0x8c, 0x53, 0xe2, 0x4d, 0x68,
+  0x92, 0x32, 0x7e, 0x5a, 0xfb, 0xfe, 0xea, 0x45, 0xeb, 0xa8, 0xa6, 0x4a, 0x23, 0x3a, 0x65, 0xa7,
+  0xb5, 0xeb, 0x80, 0x2d, 0x66, 0x71, 0xc2, 0x6b, 0xc4, 0x8b, 0x23, 0xce, 0x22, 0xc0, 0x5a, 0x04,
+  0x3e, 0x9f, 0x9c, 0xfa, 0xec, 0x3a, 0xf0, 0x58, 0x4b, 0xbc, 0x34, 0x49, 0x10, 0x05, 0x3c, 0xa0,
+  0x61, 0x2b, 0xf5, 0x68, 0xc8, 0x4e, 0xbb, 0xed, 0x0e, 0x50, 0xe1, 0x01, 0x0f, 0xd9, 0xd9, 0xb7,
+  0x74, 0x3e, 0x66, 0xe4, 0x39, 0x54, 0x4e, 0xe2, 0x10, 0x7f, 0x8e, 0x82, 0xf1, 0x3c, 0xa1, 0x3c,
+  0x88, 0xa3, 0x93, 0x7d, 0x89, 0x72, 0x92, 0xf2, 0x25, 0xfc, 0xf8, 0xb2, 0x39, 0x18, 0x0c, 0xd9,
+  0x28, 0x4e, 0x18, 0x3c, 0xd0, 0x11, 0x67, 0xc9, 0x6a, 0x18, 0xdf, 0xb4, 0xd2, 0xe0, 0xd7, 0x20,
+  0x1a, 0x0f, 0x86, 0x71, 0xe2, 0xb3, 0xa4, 0x05, 0x25, 0xc7, 0xf2, 0x71, 0xd0, 0x21, 0x69, 0x1c,
+  0x06, 0x3e, 0xf9, 0x9c, 0xf5, 0xd8, 0x53, 0x36, 0xbc, 0xc5, 0x1e, 0xae, 0xc2, 0x20, 0x62, 0xad,
+  0x09, 0x0b, 0xc6, 0x13, 0x3e, 0xe8, 0xb6, 0x7b, 0xc7, 0xad, 0x05, 0x1b, 0x7e, 0x08, 0x78, 0x8b,
+  0xb3, 0x1b, 0x8e, 0xa4, 0x58, 0x8b, 0xfa, 0xff, 0x98, 0xa7, 0x00, 0xec, 0x74, 0xbe, 0xb8, 0x1d,
+  0xc6, 0xfe, 0x72, 0x35, 0xa5, 0xc9, 0x38, 0x88, 0x06, 0x9d, 0x63, 0xb3, 0x6e, 0x10, 0x4d, 0x58,
+  0x12, 0xf0, 0xdb, 0x49, 0xb7, 0x39, 0x71, 0x9b, 0xb3, 0x1c, 0x69, 0x04, 0x3d, 0x11, 0x84, 0x34,
+  0x8a, 0x2c, 0x59, 0xd8, 0xd5, 0x86, 0x73, 0xce, 0xe3, 0xa8, 0x19, 0x44, 0xb3, 0x39, 0x6f, 0xa6,
+  0x2c, 0x64, 0x1e, 0x5f, 0x21, 0x5e, 0x56, 0xc9, 0x8b, 0xc3, 0x38, 0xc9, 0xde, 0x32, 0xea, 0x33,
+  0xea, 0xfb, 0xd8, 0xdb, 0x8e, 0xa2, 0xb0, 0x1a, 0x52, 0xef, 0xc3, 0x38, 0x89, 0xe7, 0x91, 0xdf,
+  0x92, 0x55, 0x78, 0x42, 0xa3, 0x74, 0x46, 0x13, 0x18, 0x8a, 0x63, 0x6f, 0x9e, 0xa4, 0x50, 0x34,
+  0x8b, 0x03, 0x18, 0x9a, 0xe4, 0x96, 0xd3, 0x61, 0xc8, 0x56, 0x4a, 0x50, 0x80, 0x1d, 0xd2, 0x59,
+  0xca, 0x06, 0xfa, 0xe1, 0x38, 0x07, 0xe4, 0x2d, 0xdf, 0x7a, 0x34, 0xba, 0xa6, 0xe9, 0xca, 0x0f,
+  0xd2, 0x59, 0x48, 0x97, 0x83, 0x61, 0x18, 0x7b, 0x1f, 0x6e, 0xdb, 0x38, 0xd6, 0x14, 0xa4, 0x91,
+  0xac, 0xc4, 0xf8, 0x4a, 0x61, 0xfd, 0xc7, 0x94, 0xf9, 0x01, 0x25, 0xce, 0x34, 0x88, 0xe4, 0xb0,
+  0x0f, 0xfa, 0x87, 0x9d, 0xd9, 0x4d, 0x63, 0x65, 0xa0, 0x4f, 0xe9, 0x8d, 0x09, 0xbb, 0xad, 0xa8,
+  0xf4, 0xb4, 0x7f, 0xb4, 0xb6, 0x92, 0x80, 0x55, 0x55, 0xea, 0x76, 0xdc, 0xc3, 0xb5, 0xb5, 0x24,
+  0xb0, 0xb2, 0x9a, 0x7b, 0xb4, 0x9e, 0x43, 0x09, 0xac, 0xac, 0xd6, 0x3b, 0xe8, 0xaf, 0xaf, 0x26,
+  0x80, 0xb7, 0xb7, 0x6d, 0x21, 0xab, 0xa2, 0xe4, 0x46, 0x21, 0xbb, 0xc9, 0xca, 0xf0, 0xe5, 0xb6,
+  0x3d, 0x4e, 0x02, 0x3f, 0x2b, 0xc2, 0x97, 0xdb, 0xf6, 0x24, 0xf0, 0x7d, 0x16, 0x65, 0x85, 0x51,
+  0x1c, 0x31, 0x59, 0xb5, 0xb5, 0x48, 0xe8, 0x6c, 0x95, 0x3d, 0x0d, 0xf0, 0x9f, 0xdb, 0x76, 0xc0,
+  0xd9, 0x34, 0x6d, 0x79, 0x0c, 0x47, 0x79, 0x45, 0xc3, 0x60, 0x1c, 0xb5, 0x44, 0xd1, 0x40, 0x16,
+  0x69, 0x04, 0x16, 0xf9, 0x16, 0x54, 0x90, 0x81, 0xc2, 0xdb, 0x36, 0xce, 0xf8, 0x60, 0xb4, 0xd4,
+  0x24, 0xb2, 0x57, 0xb9, 0xa4, 0x33, 0x32, 0xba, 0x7c, 0xc8, 0xf8, 0x82, 0x01, 0x7f, 0x45, 0x3c,
+  0x98, 0x77, 0xb0, 0xe4, 0x15, 0x54, 0x76, 0x0c, 0xa7, 0x53, 0xda, 0xea, 0xae, 0xc4, 0x33, 0xb4,
+  0x0a, 0xfd, 0xe1, 0x0c, 0x0b, 0xe7, 0xd3, 0x28, 0x1d, 0x24, 0x6c, 0xc6, 0x28, 0x77, 0xba, 0x4d,
+  0x90, 0x2d, 0x48, 0xd0, 0xe9, 0x34, 0xbb, 0xa3, 0xa4, 0xd1, 0x30, 0xab, 0xba, 0x9b, 0xab, 0xba,
+  0xe5, 0xaa, 0x74, 0x86, 0x95, 0x40, 0x38, 0x9d, 0x76, 0x2f, 0x61, 0x53, 0x59, 0x72, 0x28, 0x4a,
+  0xba, 0xd9, 0x7b, 0x5f, 0xbe, 0x2b, 0x0c, 0xc9, 0xf8, 0xb2, 0x75, 0x78, 0xf6, 0x25, 0x79, 0x42,
+  0xbe, 0x54, 0xab, 0xb9, 0xc5, 0x63, 0x5d, 0x45, 0x23, 0xf4, 0x2b, 0x10, 0x14, 0x8d, 0x45, 0x6b,
+  0x34, 0x0f, 0x43, 0x73, 0x41, 0xb4, 0xa7, 0x37, 0x2d, 0x3a, 0xe7, 0xb1, 0xc6, 0x0e, 0xd9, 0x88,
+  0x0f, 0xb0, 0x40, 0xad, 0xe7, 0x56, 0x22, 0x74, 0x02, 0x96, 0x00, 0x2e, 0x07, 0x29, 0x19, 0x64,
+  0x3b, 0x6d, 0x57, 0xd2, 0x05, 0x80, 0x6b, 0x03, 0xb2, 0xf2, 0xc3, 0x32, 0xa3, 0x50, 0x7a, 0x64,
+  0x96, 0xba, 0xb2, 0x74, 0x98, 0xd3, 0x18, 0xc6, 0xa0, 0x38, 0xa6, 0x39, 0x99, 0x61, 0x4e, 0x46,
+  0x81, 0xba, 0x1a, 0xd0, 0x2f, 0x02, 0x74, 0x9d, 0x30, 0x27, 0x27, 0x3a, 0xa5, 0x89, 0xa1, 0xe4,
+  0x33, 0x15, 0x95, 0x95, 0x1d, 0x18, 0x65, 0x4f, 0x55, 0xe1, 0x4d, 0x5e, 0xaa, 0x49, 0x08, 0x90,
+  0xd6, 0x70, 0x4a, 0x36, 0x66, 0x85, 0x43, 0xbb, 0x42, 0xb7, 0x8c, 0xdd, 0xd5, 0xa8, 0x47, 0x36,
+  0xaa, 0x5b, 0x46, 0x95, 0x72, 0x99, 0x2d, 0x41, 0xe8, 0x1a, 0x60, 0x48, 0x3d, 0x43, 0xce, 0x84,
+  0xa5, 0x06, 0x03, 0x2a, 0xb8, 0x85, 0x0a, 0xd5, 0xf8, 0x19, 0xfa, 0x91, 0x85, 0xee, 0x56, 0x20,
+  0x2b, 0x56, 0xb8, 0xd1, 0xc1, 0x7c, 0x3c, 0xa1, 0xb8, 0x6f, 0x17, 0x6b, 0xd2, 0x43, 0x83, 0xb4,
+  0x45, 0x49, 0x5a, 0x20, 0xb0, 0x02, 0xc2, 0xa2, 0xb4, 0x46, 0x74, 0x1a, 0x84, 0xcb, 0xc1, 0x3c,
+  0x10, 0x65, 0xad, 0x14, 0xd4, 0xfa, 0xa8, 0x99, 0x2e, 0x53, 0x58, 0x51, 0xad, 0x79, 0xd0, 0x6c,
+  0xd1, 0xd9, 0x2c, 0x64, 0x2d, 0x59, 0xd0, 0xac, 0x5d, 0xb2, 0x71, 0xcc, 0xc8, 0xf7, 0x2f, 0x6b,
+  0xcd, 0xf7, 0x31, 0x50, 0x8d, 0x9b, 0xb5, 0xef, 0x58, 0x78, 0xcd, 0x78, 0xe0, 0x51, 0xf2, 0x86,
+  0xcd, 0x59, 0xad, 0xf9, 0x2c, 0x01, 0x43, 0xde, 0xcc, 0x69, 0xe9, 0x06, 0xd9, 0x34, 0x18, 0xc6,
+  0xa1, 0xbf, 0x32, 0xcd, 0x5d, 0xbf, 0xd3, 0x51, 0xe0, 0x12, 0xe8, 0x29, 0x82, 0x84, 0xd5, 0xbd,
+  0x51, 0x8c, 0x0a, 0xa3, 0xa9, 0xa7, 0x81, 0x65, 0xa7, 0x45, 0xb7, 0xa4, 0x85, 0x9e, 0x5a, 0xb8,
+  0x47, 0x15, 0xc8, 0x7a, 0xa8, 0x04, 0x7e, 0x38, 0x36, 0xf0, 0xbb, 0xed, 0xae, 0x5b, 0x81, 0xff,
+  0xd4, 0xc0, 0xbf, 0x09, 0x2d, 0xfc, 0x6d, 0xe8, 0x6e, 0x01, 0xbf, 0x84, 0x2e, 0x47, 0x24, 0x04,
+  0x5f, 0x4a, 0x8c, 0x1f, 0x96, 0xad, 0x8a, 0xdc, 0xe6, 0xf0, 0x28, 0x4e, 0xa6, 0xb4, 0xe4, 0xa3,
+  0x40, 0x5b, 0x09, 0x58, 0x79, 0x13, 0x81, 0x71, 0xd0, 0xc7, 0x2d, 0x54, 0x4a, 0xd2, 0x19, 0x50,
+  0x9d, 0x85, 0xb9, 0xbe, 0x12, 0x4f, 0x42, 0xcb, 0x0f, 0xf0, 0x5d, 0x81, 0x94, 0x62, 0x37, 0x80,
+  0x5a, 0xa7, 0x8b, 0x22, 0xb1, 0x26, 0x4c, 0xa8, 0x28, 0x50, 0xc0, 0xc5, 0x04, 0xcc, 0xc5, 0x4a,
+  0xba, 0x05, 0x9f, 0x8f, 0x46, 0x23, 0x55, 0x3c, 0x4e, 0xe8, 0xb2, 0xd5, 0xeb, 0x74, 0x34, 0xa4,
+  0x3f, 0x7c, 0x0a, 0x06, 0xd3, 0x04, 0xf6, 0x73, 0xe0, 0xe1, 0xb0, 0xd7, 0xeb, 0x1f, 0x98, 0xc0,
+  0xa7, 0x39, 0xf0, 0xe0, 0xe9, 0x61, 0xb7, 0xd7, 0xd5, 0xac, 0x30, 0xdf, 0xac, 0xe8, 0x7b, 0x6e,
+  0xdf, 0xed, 0x1b, 0x30, 0xa3, 0xde, 0xf0, 0xab, 0xae, 0xd7, 0xf5, 0x32, 0xa2, 0x60, 0x73, 0xcc,
+  0x9a, 0xdd, 0x3e, 0x3d, 0x38, 0xa4, 0x16, 0xd4, 0xa8, 0xdb, 0xed, 0x1d, 0x75, 0x0e, 0xc0, 0xf2,
+  0x0d, 0xc7, 0xaa, 0x7f, 0x25, 0x47, 0x4a, 0x76, 0x15, 0xe0, 0x82, 0x5d, 0x50, 0xe8, 0x55, 0x28,
+  0x07, 0xa3, 0xc3, 0x51, 0x3f, 0xc7, 0xea, 0x55, 0x62, 0x69, 0xc9, 0x00, 0x16, 0xf6, 0x60, 0x0d,
+  0x29, 0xc6, 0x5c, 0xe6, 0x66, 0x48, 0xd5, 0x94, 0xd8, 0xe8, 0x10, 0xfe, 0x53, 0xed, 0x61, 0x8f,
+  0xaa, 0x69, 0xf9, 0xde, 0xc8, 0x63, 0x4f, 0x0d, 0xb4, 0x6a, 0x6a, 0xae, 0xeb, 0xf5, 0x7a, 0x4c,
+  0xa0, 0x0d, 0xc3, 0x39, 0x5b, 0x83, 0x75, 0x30, 0x3c, 0x72, 0x45, 0x1f, 0x85, 0x7b, 0xa8, 0xdd,
+  0x47, 0x65, 0xe6, 0xc0, 0xd1, 0x51, 0x80, 0x16, 0xd7, 0x20, 0xd0, 0x52, 0x15, 0xe0, 0xe1, 0x2a,
+  0xf3, 0xd0, 0x51, 0x57, 0x55, 0x60, 0x08, 0x09, 0xba, 0xc8, 0x83, 0xe9, 0x88, 0x6a, 0xef, 0xbd,
+  0x2d, 0x98, 0x62, 0xbe, 0x86, 0x26, 0xb0, 0x64, 0xe6, 0x69, 0xae, 0x99, 0xd3, 0x09, 0xf5, 0xe3,
+  0x85, 0x8c, 0x08, 0xc4, 0x23, 0xf8, 0xff, 0x40, 0x9d, 0x1c, 0xc0, 0xdf, 0x0e, 0x49, 0xc6, 0x43,
+  0x0a, 0x2e, 0x82, 0xf8, 0xd3, 0xee, 0x36, 0x9a, 0x12, 0xe6, 0xc2, 0xdf, 0x16, 0x3e, 0x14, 0xc0,
+  0x9a, 0x5a, 0x6b, 0xea, 0xdb, 0x04, 0xc1, 0x8d, 0x24, 0xfd, 0x35, 0x95, 0x80, 0x26, 0xd2, 0x43,
+  0x94, 0x96, 0xbb, 0x81, 0x66, 0x10, 0x45, 0x3a, 0x72, 0x91, 0x64, 0x83, 0x08, 0x82, 0x2b, 0x92,
+  0xd7, 0x2e, 0x70, 0xdb, 0xe9, 0x41, 0x5d, 0x50, 0xd2, 0x8c, 0x82, 0x67, 0x0f, 0x4e, 0x08, 0x3a,
+  0x83, 0x2b, 0x1d, 0xb6, 0xe4, 0xe5, 0xc2, 0x49, 0x3c, 0x2e, 0xbc, 0x83, 0x27, 0x19, 0x5f, 0xb3,
+  0xe4, 0xe7, 0x81, 0x9e, 0xa0, 0xb0, 0x02, 0x06, 0xa2, 0xa8, 0x6a, 0xa0, 0xd5, 0x32, 0xcc, 0xab,
+  0xa8, 0xf5, 0xb6, 0xb6, 0x86, 0x5e, 0x80, 0x66, 0x23, 0x6a, 0x9d, 0xad, 0xad, 0xa3, 0x17, 0x5e,
+  0x5e, 0x47, 0xcc, 0xbd, 0x8d, 0x55, 0xfc, 0x43, 0xe6, 0x1f, 0x65, 0x55, 0x70, 0x1a, 0x24, 0xa8,
+  0x23, 0x55, 0x05, 0xb1, 0xc0, 0x7d, 0xe6, 0xc5, 0x32, 0x6a, 0xcc, 0xe1, 0x68, 0x7a, 0xbc, 0x79,
+  0xfa, 0xf3, 0x20, 0x9e, 0x73, 0xa1, 0x53, 0x51, 0x24, 0x03, 0x51, 0xb6, 0x52, 0x45, 0x03, 0x14,
+  0xba, 0x0c, 0x13, 0xcd, 0xc0, 0x49, 0x57, 0x88, 0x47, 0x23, 0x18, 0x1b, 0x44, 0xca, 0x68, 0xa9,
+  0x51, 0xd4, 0xf5, 0x25, 0x35, 0x6b, 0x92, 0xe0, 0x9f, 0x03, 0x3d, 0x01, 0xfa, 0xfd, 0x26, 0x04,
+  0x04, 0x4d, 0xd7, 0xed, 0xc1, 0x50, 0xc2, 0x48, 0xae, 0x8f, 0x77, 0xa6, 0xfe, 0xcf, 0x83, 0x8f,
+  0x70, 0x7b, 0xed, 0xea, 0x07, 0x9b, 0xab, 0x1f, 0x6c, 0xa9, 0x7e, 0xb8, 0xb9, 0xfa, 0xe1, 0x96,
+  0xea, 0xbd, 0xcd, 0xd5, 0x7b, 0xc5, 0xea, 0xb7, 0x27, 0xfb, 0x32, 0xc4, 0x3f, 0xd9, 0x97, 0xdb,
+  0x0e, 0x18, 0x77, 0x13, 0x2f, 0xa4, 0x69, 0x7a, 0x5a, 0x33, 0x34, 0x30, 0xc9, 0x5c, 0x1b, 0x62,
+  0x9b, 0x4c, 0x52, 0xb0, 0x90, 0xb5, 0xb3, 0x13, 0x3f, 0xb8, 0xd6, 0x14, 0xb2, 0x28, 0x8d, 0x28,
+  0x87, 0x9c, 0xa0, 0x37, 0x49, 0xd0, 0x39, 0xb3, 0x11, 0xb5, 0x31, 0x20, 0xd9, 0xf2, 0x27, 0x4a,
+  0xeb, 0x60, 0x8d, 0x23, 0x82, 0xce, 0x18, 0x41, 0xc7, 0x8b, 0xa0, 0xd7, 0x8c, 0x9b, 0x24, 0x5d,
+  0x5d, 0x55, 0xbb, 0x03, 0x24, 0xf3, 0x76, 0x88, 0x61, 0x78, 0x89, 0x65, 0xf7, 0xb0, 0x76, 0xbf,
+  0xb6, 0x79, 0xe7, 0x63, 0xd2, 0x3d, 0x3b, 0x19, 0x41, 0x5f, 0x48, 0xe0, 0x8b, 0x0e, 0x00, 0xec,
+  0x05, 0xbc, 0xd6, 0x74, 0x7b, 0x59, 0x40, 0x62, 0xf7, 0x20, 0x0b, 0x64, 0x90, 0x39, 0xd7, 0x62,
+  0x4e, 0xf3, 0xa6, 0x1d, 0x35, 0x62, 0x19, 0xea, 0xda, 0xd9, 0xf3, 0x09, 0x05, 0xcd, 0x14, 0x42,
+  0xd3, 0xae, 0x45, 0x12, 0x87, 0x92, 0x18, 0xa1, 0x1c, 0x99, 0xfa, 0xe6, 0x3c, 0x25, 0x22, 0xba,
+  0x92, 0x5c, 0x9c, 0x9d, 0x84, 0x74, 0xc8, 0xc2, 0x4c, 0x9c, 0x18, 0xf2, 0x16, 0xba, 0xae, 0xbc,
+  0x38, 0x43, 0x4c, 0x18, 0x9b, 0xd4, 0xe0, 0x3d, 0x81, 0x7e, 0x4a, 0x16, 0x6a, 0x67, 0xe4, 0xc2,
+  0x0f, 0x38, 0x0c, 0x27, 0x51, 0x4c, 0x0d, 0xc8, 0xc9, 0xbe, 0x20, 0x6d, 0x71, 0x86, 0xf1, 0x2b,
+  0x31, 0x63, 0x5f, 0xe0, 0x42, 0xee, 0xa5, 0x64, 0xe2, 0x10, 0xe3, 0x48, 0x0a, 0xda, 0x93, 0x48,
+  0x13, 0x92, 0x8d, 0xad, 0x8c, 0xdc, 0x70, 0x3e, 0xb8, 0x38, 0xce, 0x07, 0x05, 0x96, 0x2d, 0xef,
+  0x8d, 0x88, 0x05, 0x6f, 0x69, 0x14, 0x55, 0x64, 0x2b, 0x86, 0x9a, 0x1c, 0x38, 0xdd, 0xa1, 0x93,
+  0x78, 0x86, 0xe3, 0x4a, 0xae, 0x29, 0x28, 0xbb, 0xd3, 0x1a, 0x88, 0xbb, 0x7b, 0xb2, 0x2f, 0xcb,
+  0x60, 0xd2, 0x4b, 0xa6, 0xe1, 0x41, 0xc8, 0x50, 0xfe, 0x7b, 0x7f, 0xe2, 0x7c, 0x0e, 0xdd, 0xe4,
+  0x20, 0x53, 0x25, 0xcb, 0x74, 0x77, 0x61, 0x8a, 0xed, 0xa9, 0x4f, 0x4c, 0x96, 0xb2, 0x37, 0x84,
+  0x2f, 0x67, 0x20, 0xc7, 0x68, 0x3e, 0x1d, 0x02, 0xa7, 0x04, 0xf4, 0xc9, 0x69, 0xad, 0x0b, 0x3f,
+  0xe9, 0xcd, 0x69, 0xed, 0x00, 0xa7, 0xc1, 0x8c, 0x46, 0x9a, 0x71, 0x8c, 0x56, 0x8b, 0x93, 0x3d,
+  0x61, 0x29, 0xa7, 0x09, 0x07, 0xd1, 0x03, 0xa2, 0x2d, 0xf8, 0xc2, 0x20, 0xdc, 0x65, 0x19, 0xdc,
+  0xdf, 0x62, 0x7c, 0xcf, 0xd2, 0x00, 0x38, 0x04, 0x29, 0x93, 0x4b, 0x70, 0xf6, 0x41, 0x64, 0x69,
+  0xb6, 0x30, 0x3f, 0x76, 0x5a, 0x80, 0x90, 0x72, 0xf2, 0x30, 0x2f, 0x5e, 0xd3, 0x1b, 0x62, 0xb4,
+  0xe7, 0x5c, 0x4c, 0x67, 0x7c, 0x49, 0xae, 0x68, 0xf4, 0xa1, 0xf1, 0x48, 0xa7, 0x8a, 0xdd, 0xc3,
+  0xaa, 0xb9, 0xd2, 0x51, 0x73, 0x05, 0x8c, 0x4a, 0x67, 0x87, 0xe9, 0xf2, 0x76, 0x32, 0x4d, 0xab,
+  0xe6, 0xca, 0x7d, 0x8c, 0x46, 0x10, 0xd9, 0xa3, 0x11, 0x44, 0xd6, 0x68, 0xbc, 0x40, 0x19, 0x3d,
+  0xea, 0xc1, 0xb0, 0x3a, 0xf8, 0x69, 0x0f, 0xc6, 0x87, 0x28, 0x5e, 0x28, 0x6e, 0x63, 0x10, 0x24,
+  0xf9, 0x2b, 0xbe, 0x13, 0x5d, 0xf0, 0x48, 0x07, 0xc0, 0xee, 0xd4, 0xb6, 0x01, 0xf8, 0x98, 0x11,
+  0x28, 0x29, 0xcd, 0x8f, 0xd0, 0x80, 0xef, 0x7e, 0x7c, 0xfd, 0x00, 0xaa, 0x2f, 0x88, 0xce, 0xe7,
+  0x7c, 0xa9, 0x96, 0x19, 0x3e, 0x2a, 0x75, 0xf7, 0x88, 0x17, 0x97, 0xe8, 0xd0, 0xa6, 0x51, 0x75,
+  0x7b, 0xbd, 0xda, 0xfd, 0xab, 0x2d, 0x7a, 0xa3, 0x25, 0x09, 0xe6, 0x43, 0x4a, 0x12, 0x55, 0xd5,
+  0x23, 0x36, 0x19, 0x7f, 0x8e, 0x20, 0x87, 0xc0, 0xc3, 0x87, 0xab, 0x09, 0x38, 0x24, 0x13, 0x80,
+  0x80, 0x3c, 0xbf, 0xc1, 0x02, 0x92, 0x95, 0x3c, 0x52, 0x79, 0x16, 0xba, 0xf5, 0x6f, 0x17, 0x6b,
+  0x18, 0x2f, 0x5e, 0xb1, 0x6b, 0x16, 0x9a, 0x92, 0x7d, 0x05, 0x02, 0x11, 0x85, 0x8f, 0x5e, 0xba,
+  0xe5, 0xde, 0xdd, 0x4d, 0xc0, 0xf7, 0xaf, 0xae, 0xaf, 0x82, 0x29, 0xc6, 0x6b, 0x25, 0x8d, 0xbd,
+  0x9b, 0xfb, 0x7c, 0x70, 0x9f, 0x51, 0xa4, 0x98, 0x7a, 0x2f, 0x71, 0xd8, 0xae, 0x71, 0x27, 0x40,
+  0x2d, 0x28, 0x5d, 0xf0, 0x98, 0xd7, 0x53, 0xd6, 0xa9, 0xaa, 0xd1, 0xee, 0xdd, 0xd1, 0x8d, 0x7a,
+  0x30, 0x27, 0x0a, 0xb8, 0xba, 0xa4, 0xd3, 0x59, 0xc8, 0x52, 0x10, 0xfe, 0xb3, 0xf3, 0xe7, 0x44,
+  0xbd, 0x3d, 0x52, 0xc9, 0x1b, 0xdd, 0xd9, 0x14, 0x75, 0x76, 0x85, 0xd0, 0xef, 0x59, 0x94, 0x29,
+  0x67, 0xb3, 0x73, 0x16, 0x52, 0xb4, 0xb3, 0x97, 0xf0, 0x4c, 0xc4, 0xcb, 0x23, 0x15, 0x64, 0xde,
+  0x99, 0xed, 0x72, 0xfc, 0xd3, 0x26, 0x6f, 0xca, 0x13, 0x46, 0xa7, 0xef, 0x29, 0xc7, 0x58, 0xec,
+  0x55, 0x70, 0xcd, 0xc8, 0xf7, 0x33, 0x1f, 0xde, 0x08, 0x16, 0x3d, 0x5a, 0xc1, 0x67, 0x7d, 0xda,
+  0x24, 0xf9, 0xde, 0x2e, 0x82, 0xff, 0xee, 0xd7, 0x07, 0x12, 0xfc, 0xc4, 0x3d, 0x67, 0x43, 0x10,
+  0x85, 0xc7, 0x5e, 0xa3, 0xde, 0xf8, 0xce, 0x25, 0x6f, 0xc1, 0x43, 0x57, 0x45, 0x8f, 0x54, 0xf0,
+  0x56, 0x9f, 0xee, 0x21, 0xf2, 0x7d, 0xb0, 0x59, 0x3f, 0x71, 0xbf, 0x0d, 0x03, 0xee, 0x4d, 0xbe,
+  0xd7, 0xa2, 0x1f, 0x8d, 0x88, 0x2c, 0x21, 0x2f, 0x82, 0x10, 0x24, 0xfb, 0x68, 0x07, 0x20, 0xeb,
+  0xd7, 0x16, 0xf1, 0xef, 0x20, 0xfd, 0xff, 0xfd, 0x9f, 0xf4, 0x0e, 0xfb, 0x85, 0x1f, 0x13, 0xfa,
+  0x5e, 0x40, 0xe8, 0x8b, 0xdb, 0x93, 0xf3, 0xd9, 0x27, 0xe1, 0x50, 0xcd, 0xd8, 0x14, 0x82, 0xbc,
+  0x1f, 0x70, 0xeb, 0x1a, 0xa6, 0xc7, 0x7b, 0x30, 0x86, 0x22, 0xe8, 0x13, 0x05, 0x8f, 0x74, 0x62,
+  0x98, 0x5d, 0xda, 0xee, 0x3a, 0x6f, 0x9b, 0x19, 0x9d, 0x16, 0xe0, 0x3d, 0xd0, 0xd2, 0x04, 0x4e,
+  0xd1, 0xf2, 0x5f, 0x06, 0xbf, 0x66, 0xc2, 0x17, 0x9e, 0x00, 0x16, 0x3c, 0x5e, 0xe1, 0x67, 0x5d,
+  0xfa, 0x68, 0x83, 0x34, 0x03, 0x96, 0xd1, 0xb3, 0x78, 0x30, 0x7f, 0xe0, 0xff, 0x3d, 0xb0, 0x3b,
+  0xd8, 0xa2, 0xfb, 0x57, 0x86, 0x32, 0x60, 0xbf, 0x48, 0x79, 0x30, 0xa5, 0x3c, 0x4e, 0xee, 0xa8,
+  0x07, 0x0f, 0xef, 0x53, 0x0f, 0x86, 0xc8, 0x8a, 0xb4, 0x87, 0x30, 0x1b, 0xde, 0x30, 0xe6, 0x87,
+  0xac, 0x6c, 0x1f, 0x3f, 0xad, 0x13, 0x48, 0x8b, 0xe7, 0xc2, 0x29, 0x64, 0xb7, 0x76, 0xf6, 0x57,
+  0x1a, 0x4e, 0x61, 0x9c, 0x9d, 0x59, 0xc2, 0xfc, 0xc0, 0xe3, 0xe0, 0xef, 0x36, 0xf2, 0x73, 0xc9,
+  0xd2, 0x99, 0xe5, 0xe5, 0x34, 0x8e, 0xf9, 0x04, 0xe3, 0x7c, 0x27, 0x64, 0x63, 0xea, 0x2d, 0x1b,
+  0x6b, 0x0f, 0x31, 0xef, 0x4b, 0xdc, 0x6f, 0xe2, 0x20, 0x15, 0xae, 0xb8, 0x98, 0x06, 0xe2, 0xed,
+  0xb1, 0xee, 0xd9, 0xe4, 0xdd, 0xa9, 0xb4, 0x38, 0x6d, 0x43, 0xed, 0x09, 0x8d, 0x26, 0xcb, 0xb6,
+  0xaf, 0x44, 0x7f, 0xce, 0x97, 0x0f, 0xa4, 0xfd, 0x12, 0x88, 0x19, 0xf4, 0x08, 0x60, 0xfc, 0xf0,
+  0xa8, 0x07, 0x20, 0xef, 0x4c, 0xb5, 0xfc, 0x3b, 0x9d, 0x4c, 0x03, 0xe6, 0x03, 0x80, 0x85, 0xbb,
+  0x0d, 0xc1, 0xfe, 0x43, 0x39, 0xe7, 0x7a, 0xb3, 0xef, 0x55, 0x1c, 0x7f, 0xa0, 0x98, 0x1f, 0x83,
+  0x67, 0xf9, 0x73, 0x1e, 0x83, 0x8f, 0x9e, 0x15, 0x3d, 0xf2, 0x7d, 0xcc, 0xbc, 0x6b, 0x1b, 0xdd,
+  0x74, 0x77, 0x17, 0xc3, 0xf4, 0x6f, 0xb2, 0x4b, 0x2a, 0x7b, 0x87, 0x86, 0xc1, 0x30, 0xcb, 0xd9,
+  0x01, 0xcb, 0x34, 0xb3, 0x88, 0xc0, 0x90, 0x16, 0xaa, 0x91, 0x6f, 0x12, 0xd4, 0x9f, 0x7c, 0xc2,
+  0x08, 0xa7, 0x11, 0xcc, 0x83, 0x98, 0x50, 0x22, 0x4e, 0xe8, 0x88, 0x50, 0x10, 0x4d, 0xa2, 0x12,
+  0x86, 0x00, 0x61, 0x2c, 0x9a, 0xc0, 0xb9, 0x05, 0xaf, 0x94, 0x4b, 0x04, 0x92, 0x4e, 0xe2, 0x39,
+  0xb0, 0x03, 0x3f, 0x60, 0xe0, 0x22, 0x9f, 0x80, 0xea, 0x4e, 0x53, 0x60, 0x64, 0xc6, 0xe7, 0x09,
+  0x6b, 0xeb, 0x07, 0x22, 0xf0, 0x69, 0xca, 0x09, 0x5f, 0xc4, 0xb2, 0x66, 0xda, 0x44, 0xaa, 0x11,
+  0xb9, 0xa4, 0xd7, 0xcc, 0x4e, 0x37, 0x6a, 0x93, 0x1f, 0x03, 0x0e, 0x64, 0x39, 0xf0, 0xe2, 0xcd,
+  0x13, 0x00, 0xe7, 0xcd, 0x8f, 0xe2, 0x10, 0x46, 0x29, 0x05, 0x48, 0xca, 0x13, 0x2a, 0x86, 0x18,
+  0xc7, 0x8f, 0xa8, 0x5b, 0x1e, 0x02, 0xf3, 0x75, 0x10, 0xed, 0x17, 0xb2, 0x08, 0x90, 0x33, 0x5d,
+  0x2c, 0x4e, 0x87, 0x52, 0x15, 0xc8, 0xb4, 0x61, 0xa6, 0xce, 0xee, 0x1e, 0xc9, 0x90, 0xec, 0x0a,
+  0x8b, 0xb6, 0xe5, 0x06, 0x85, 0x35, 0xb2, 0x7e, 0x3e, 0x4f, 0x30, 0x9b, 0xcf, 0x60, 0xcb, 0x98,
+  0x01, 0x22, 0xa5, 0x84, 0x86, 0xb8, 0xc5, 0x63, 0x1e, 0x4f, 0xeb, 0x95, 0x63, 0x67, 0x71, 0x85,
+  0xe3, 0xda, 0x59, 0xab, 0x45, 0x7e, 0xff, 0xed, 0xde, 0x53, 0x74, 0x68, 0xa8, 0x8e, 0xd1, 0x84,
+  0x90, 0xa0, 0x0c, 0x04, 0x1a, 0xa4, 0xd2, 0xdc, 0x3d, 0xd6, 0x44, 0x1d, 0xd5, 0xa7, 0x87, 0x8d,
+  0xab, 0x2c, 0x71, 0x88, 0x3b, 0x3f, 0x40, 0x50, 0x5e, 0x8a, 0xd3, 0x5c, 0xa8, 0xa5, 0xf0, 0x0d,
+  0x8f, 0x6a, 0x56, 0x32, 0xa1, 0xca, 0x88, 0x26, 0x22, 0x7d, 0xd4, 0xca, 0x5a, 0x25, 0x79, 0xc2,
+  0xbb, 0x31, 0x5e, 0x5a, 0x46, 0x87, 0x99, 0xf0, 0x76, 0x96, 0x87, 0x14, 0x81, 0x64, 0x0b, 0xd5,
+  0xb6, 0x5a, 0x9c, 0x27, 0xfb, 0xb2, 0xa8, 0xc4, 0x31, 0x88, 0x3d, 0x29, 0xf1, 0x2b, 0x13, 0xcb,
+  0x4d, 0x76, 0xcd, 0xa9, 0xf5, 0x80, 0xdc, 0x22, 0x37, 0x60, 0x6a, 0x50, 0x21, 0xe4, 0x1c, 0x9b,
+  0xe3, 0x20, 0x6e, 0x14, 0x6a, 0x5e, 0xd5, 0x8c, 0xb2, 0x16, 0x23, 0x5e, 0x41, 0xb0, 0x67, 0x16,
+  0x5e, 0xfc, 0x94, 0x49, 0x9e, 0x3c, 0xc9, 0x7a, 0xa9, 0x32, 0xc3, 0x05, 0x4c, 0x17, 0xe2, 0xdd,
+  0x1c, 0x2b, 0x11, 0xca, 0xf9, 0xfd, 0x37, 0xf0, 0x37, 0xf9, 0xa4, 0x8c, 0x74, 0x2e, 0x3c, 0x20,
+  0x09, 0x39, 0x93, 0x0f, 0xfb, 0x3c, 0x11, 0x4f, 0xb2, 0x25, 0x91, 0x4f, 0xaa, 0x64, 0x7c, 0x85,
+  0x3c, 0xe3, 0x56, 0xbd, 0x28, 0xc5, 0x9f, 0x58, 0x70, 0xbf, 0xc6, 0xe1, 0xc7, 0xe0, 0x45, 0xf0,
+  0x47, 0xb7, 0x6e, 0xee, 0x35, 0xa3, 0x72, 0x11, 0x8c, 0x82, 0xcb, 0xcb, 0x97, 0xe7, 0x30, 0x9a,
+  0x92, 0x27, 0x78, 0x36, 0xd4, 0xca, 0x27, 0xa5, 0x37, 0x32, 0x5e, 0xd5, 0x3c, 0x44, 0xc2, 0xb5,
+  0x7b, 0xd4, 0xb5, 0x48, 0xff, 0x1d, 0x54, 0x5d, 0x40, 0x87, 0xb4, 0x3c, 0xf4, 0xfb, 0xa7, 0x2c,
+  0x93, 0x8c, 0x67, 0x25, 0x97, 0x59, 0xd6, 0x87, 0xcd, 0xce, 0x4d, 0xc9, 0x50, 0x90, 0xc2, 0xfd,
+  0x4d, 0xcc, 0x67, 0x3e, 0xb4, 0xb5, 0x66, 0x0a, 0xbe, 0x41, 0x41, 0xff, 0xe8, 0xab, 0x21, 0xb9,
+  0xfe, 0xd1, 0x09, 0xfb, 0x0f, 0xad, 0x7f, 0xca, 0x8e, 0x4a, 0xb5, 0xe2, 0x04, 0x07, 0x88, 0xf1,
+  0x02, 0xd7, 0xea, 0x0e, 0x4d, 0xce, 0xb4, 0xba, 0xcb, 0xf0, 0xd0, 0x3c, 0xbf, 0x47, 0x5e, 0xd0,
+  0xab, 0x3b, 0x67, 0x23, 0x3a, 0x0f, 0x79, 0x5a, 0xd2, 0x9c, 0xda, 0xf9, 0x00, 0xad, 0xc6, 0xe7,
+  0xe9, 0x6b, 0x70, 0xde, 0xe8, 0x38, 0x77, 0x3c, 0xf0, 0x56, 0xa7, 0x95, 0x39, 0x2e, 0xaf, 0x02,
+  0xe7, 0x63, 0x8d, 0x49, 0xe1, 0xd6, 0x30, 0xe3, 0x8d, 0x4f, 0x99, 0x99, 0xae, 0xef, 0xdf, 0x90,
+  0xc2, 0x85, 0x9a, 0xbb, 0xea, 0x2f, 0x95, 0xdd, 0x2e, 0x4e, 0xbf, 0x5e, 0xc7, 0x51, 0x60, 0x6d,
+  0xbb, 0x08, 0xb7, 0x1d, 0x20, 0xe7, 0x94, 0xd3, 0xda, 0x1a, 0x8d, 0xe6, 0x56, 0x6e, 0xc2, 0x98,
+  0xdd, 0xb2, 0x13, 0x65, 0x67, 0xb0, 0x64, 0xcc, 0x34, 0x7f, 0x3d, 0x08, 0xe6, 0x8d, 0x99, 0xda,
+  0x2e, 0x1e, 0xdf, 0x5a, 0x4f, 0x2f, 0xfc, 0x38, 0x37, 0xef, 0xde, 0x19, 0xbd, 0xa2, 0xc9, 0x18,
+  0xe6, 0x89, 0x34, 0x5c, 0x25, 0x4e, 0x25, 0x54, 0x3a, 0x51, 0x9b, 0x38, 0x7d, 0x70, 0x36, 0xe5,
+  0x86, 0x0f, 0xd4, 0x5c, 0xc3, 0xa8, 0x86, 0x7f, 0x02, 0xac, 0xe2, 0xa1, 0x09, 0xee, 0x8e, 0x57,
+  0x0d, 0x3c, 0x14, 0x7f, 0x02, 0xdc, 0x5d, 0x8a, 0x05, 0x5f, 0xc1, 0xdf, 0x3b, 0xdc, 0x0f, 0x47,
+  0xd8, 0x9f, 0xcc, 0xe4, 0x39, 0xc4, 0x77, 0x91, 0xd8, 0xe7, 0xa9, 0x60, 0x52, 0x44, 0x24, 0xf2,
+  0x0c, 0xf9, 0x4f, 0x65, 0xf2, 0x2a, 0x98, 0x32, 0xd4, 0xaf, 0x22, 0x6d, 0xb3, 0x6a, 0xed, 0x00,
+  0xfc, 0x2a, 0x16, 0xd0, 0x3b, 0x70, 0x2a, 0xff, 0x95, 0x1f, 0xbb, 0xc8, 0x48, 0x3d, 0x9f, 0x50,
+  0xf1, 0x61, 0x13, 0xcb, 0xbd, 0x15, 0x0a, 0x7a, 0x6b, 0x4f, 0x88, 0xbc, 0xbe, 0x0b, 0x81, 0xce,
+  0xa1, 0x48, 0x0b, 0x91, 0x94, 0xcb, 0xe6, 0x39, 0xfb, 0x92, 0x03, 0xb1, 0x3f, 0xc1, 0xa0, 0x34,
+  0x26, 0xde, 0xfd, 0x27, 0x6b, 0x04, 0x71, 0x22, 0xc3, 0x22, 0x11, 0x43, 0x89, 0xdb, 0x53, 0x78,
+  0x4f, 0x48, 0xde, 0xeb, 0xec, 0xf5, 0x0f, 0x18, 0x38, 0xd3, 0x7f, 0xf9, 0xfc, 0xab, 0xfe, 0x81,
+  0x7b, 0xac, 0x02, 0x28, 0x2b, 0xab, 0x1c, 0x40, 0x07, 0x4f, 0x8f, 0x1b, 0x3a, 0xb6, 0x5a, 0x4b,
+  0xea, 0x2b, 0x8f, 0x1e, 0xd0, 0x51, 0x89, 0x94, 0xa5, 0xbe, 0xb6, 0x90, 0x90, 0xf7, 0x70, 0x4b,
+  0x24, 0x0a, 0xaa, 0x65, 0x0b, 0x11, 0x79, 0x0d, 0xb8, 0x44, 0x24, 0x5f, 0xf4, 0x66, 0x8c, 0x98,
+  0x5b, 0x58, 0xcc, 0x7b, 0x28, 0x2c, 0xad, 0xd2, 0xad, 0xac, 0x9b, 0x94, 0x58, 0xf7, 0x99, 0x51,
+  0xe8, 0x10, 0x53, 0x80, 0xdf, 0x11, 0x31, 0x0f, 0x1d, 0xf8, 0x76, 0xbb, 0xbd, 0x76, 0x2f, 0x29,
+  0xf5, 0x92, 0x60, 0xc6, 0xcf, 0xbc, 0x38, 0x4a, 0x39, 0x79, 0xfe, 0xec, 0xd5, 0x2f, 0xaf, 0x9f,
+  0xfd, 0xd7, 0x2f, 0xef, 0xde, 0xbe, 0x7c, 0x73, 0x75, 0x49, 0x4e, 0xc9, 0xd1, 0xf1, 0x5e, 0x0e,
+  0x79, 0xf6, 0xc3, 0xc5, 0xfb, 0x67, 0xdf, 0x5e, 0xfc, 0x72, 0xf9, 0xec, 0xf5, 0xbb, 0x57, 0x17,
+  0x08, 0x76, 0x3b, 0xc7, 0x84, 0xec, 0xef, 0xc3, 0xc0, 0x20, 0x3f, 0x04, 0xa7, 0x1c, 0x49, 0x65,
+  0xaa, 0x11, 0x01, 0xd7, 0x27, 0x01, 0xbf, 0xc0, 0x27, 0x41, 0x24, 0xb6, 0x88, 0x3c, 0x19, 0x39,
+  0x82, 0xab, 0x82, 0x1f, 0x73, 0xd9, 0x0b, 0x41, 0xfa, 0x5e, 0xbe, 0xf7, 0x04, 0xc4, 0x7e, 0xfa,
+  0xfb, 0xf1, 0xde, 0x68, 0x1e, 0x79, 0xe2, 0x35, 0x61, 0x78, 0x07, 0xd2, 0xd8, 0x9c, 0x72, 0x1a,
+  0x64, 0xa5, 0x78, 0x91, 0x31, 0xdb, 0x29, 0xf1, 0xc1, 0x9d, 0x99, 0x42, 0xbb, 0x6d, 0x18, 0xc9,
+  0x8b, 0x90, 0xe1, 0xe3, 0x37, 0xcb, 0x97, 0xbe, 0x53, 0xd7, 0x31, 0x52, 0xbd, 0x71, 0xbc, 0x27,
+  0x90, 0xdb, 0x62, 0x4e, 0x7f, 0x77, 0xf5, 0xfa, 0x15, 0x54, 0xab, 0xd7, 0xa1, 0x53, 0x39, 0xe1,
+  0x36, 0xf8, 0x23, 0x17, 0xd4, 0x9b, 0x38, 0x8e, 0x60, 0xac, 0x49, 0x82, 0x06, 0x39, 0x3d, 0xcb,
+  0x1a, 0x4b, 0xc0, 0x79, 0x36, 0x9a, 0xf2, 0x60, 0x40, 0x38, 0x53, 0xad, 0x39, 0x75, 0x9e, 0x60,
+  0x1b, 0x80, 0xd3, 0x16, 0x83, 0xf3, 0x86, 0x4e, 0x91, 0xb1, 0xba, 0x0e, 0x07, 0xeb, 0x12, 0x66,
+  0xb5, 0x7e, 0xc2, 0x7d, 0x3b, 0xf6, 0xab, 0x93, 0x27, 0x52, 0x26, 0xed, 0x24, 0x9b, 0xdf, 0x6d,
+  0x1e, 0xbf, 0x08, 0x6e, 0x98, 0xef, 0x74, 0x1b, 0x00, 0xad, 0x43, 0x88, 0x87, 0x41, 0xe0, 0xda,
+  0x8a, 0x62, 0x87, 0xed, 0xc9, 0x5e, 0x25, 0x1e, 0xc9, 0xef, 0xc7, 0xe7, 0x9e, 0xb2, 0xe5, 0xf3,
+  0x59, 0x13, 0x4b, 0xdd, 0x5e, 0x57, 0x6e, 0x67, 0x76, 0x13, 0x15, 0x3d, 0x93, 0x29, 0x14, 0x19,
+  0xbe, 0x20, 0x34, 0xa5, 0xfa, 0xf7, 0xcf, 0x39, 0x4b, 0x96, 0x97, 0xe2, 0xf4, 0x24, 0x4e, 0x9c,
+  0xba, 0xc4, 0xa8, 0x37, 0xda, 0xd4, 0xf7, 0x2f, 0xae, 0x41, 0x4e, 0xaf, 0xa0, 0x57, 0x0c, 0x44,
+  0x00, 0x23, 0x13, 0x06, 0xde, 0x87, 0x7a, 0x93, 0x38, 0x5a, 0xc6, 0xc6, 0x38, 0xa4, 0x33, 0x00,
+  0x32, 0x27, 0x68, 0x92, 0x2e, 0xca, 0xb4, 0x3c, 0x01, 0x8e, 0xf7, 0x6e, 0xb3, 0x01, 0xc5, 0x78,
+  0x26, 0xf2, 0x9f, 0x4f, 0x82, 0xd0, 0x77, 0x80, 0x05, 0x05, 0x0b, 0x46, 0xc4, 0x31, 0x49, 0x86,
+  0x2c, 0x1a, 0x43, 0xa8, 0x7d, 0x42, 0xdc, 0xc6, 0x9d, 0x07, 0x74, 0xd3, 0xa0, 0xd9, 0xeb, 0x0d,
+  0xbf, 0x1c, 0x15, 0xe2, 0xf2, 0x15, 0x37, 0xb7, 0x5e, 0x81, 0xb4, 0x68, 0x42, 0x9c, 0x28, 0x96,
+  0x3b, 0x91, 0x0d, 0x2d, 0xa9, 0xb5, 0x8c, 0xc3, 0x9f, 0x4d, 0x53, 0x39, 0xdf, 0x04, 0xda, 0x28,
+  0x52, 0xbd, 0x74, 0x8c, 0x85, 0x22, 0xa6, 0xc5, 0x29, 0x99, 0xe1, 0xc7, 0xaf, 0x5e, 0x42, 0xef,
+  0x36, 0xb5, 0x82, 0x4a, 0x0c, 0xe8, 0x8b, 0xa3, 0xb2, 0x86, 0x5e, 0xf5, 0x89, 0x5c, 0xd7, 0xa7,
+  0xe0, 0xc3, 0xe3, 0xd5, 0x8b, 0xa5, 0x39, 0x43, 0x53, 0x31, 0x5a, 0xad, 0x0a, 0xc5, 0xa0, 0x06,
+  0x42, 0x56, 0xd6, 0x63, 0x70, 0x7a, 0x7a, 0x4a, 0x3a, 0xc8, 0x1a, 0x6e, 0xfb, 0x4a, 0x8d, 0xe6,
+  0xd4, 0xdf, 0xc4, 0x52, 0x67, 0x24, 0x32, 0xbe, 0x24, 0x4b, 0xc6, 0xa1, 0x27, 0x75, 0x96, 0x24,
+  0xb1, 0x1c, 0x07, 0x06, 0x3d, 0x8f, 0x50, 0x44, 0x48, 0x30, 0x80, 0xf5, 0xf5, 0xc6, 0xc1, 0x4e,
+  0x35, 0xc8, 0xbf, 0xfe, 0x25, 0x7b, 0x77, 0x42, 0x3a, 0xd9, 0xf3, 0x19, 0x71, 0x7b, 0xbd, 0x62,
+  0x13, 0x17, 0x42, 0x4f, 0x52, 0x89, 0xa1, 0xc3, 0xc6, 0x8e, 0xd8, 0xdd, 0x05, 0xec, 0x0d, 0xad,
+  0x55, 0xcc, 0xa3, 0xb3, 0xd3, 0x82, 0x86, 0x2c, 0x36, 0xf6, 0x8c, 0x93, 0x69, 0x0c, 0x72, 0xc3,
+  0x95, 0x59, 0xd0, 0xa5, 0xb0, 0x8a, 0x2d, 0x7d, 0x27, 0x16, 0x6e, 0xba, 0xa6, 0x7d, 0x2d, 0xfd,
+  0xcc, 0xdc, 0x9d, 0xaa, 0xa1, 0x80, 0x01, 0xf0, 0xe7, 0x20, 0x76, 0x27, 0x9d, 0x4f, 0x9b, 0x24,
+  0x11, 0xab, 0x08, 0x1e, 0x81, 0x7a, 0xd2, 0x44, 0xf1, 0xee, 0x13, 0x4b, 0xea, 0xb6, 0xa2, 0x9b,
+  0xcd, 0xd3, 0x89, 0xb3, 0x32, 0xc8, 0x0e, 0xc8, 0x6b, 0xca, 0x27, 0xf2, 0xbb, 0x04, 0x8e, 0xd1,
+  0xda, 0x97, 0xa4, 0x2b, 0x68, 0x75, 0x3b, 0x4d, 0x21, 0xb7, 0x81, 0x94, 0x1e, 0xae, 0x30, 0x6b,
+  0xc1, 0xc6, 0x09, 0x77, 0x1c, 0xda, 0x24, 0x43, 0xc1, 0x07, 0x35, 0x66, 0x07, 0x69, 0x91, 0xa1,
+  0xf1, 0xba, 0x69, 0x3d, 0x6f, 0x9c, 0xfa, 0x6a, 0x37, 0xf1, 0x0e, 0x13, 0xbf, 0x64, 0x52, 0xd6,
+  0x36, 0x8c, 0x16, 0x48, 0x1e, 0xf9, 0x32, 0x5f, 0xdd, 0x2c, 0x85, 0x2a, 0x1d, 0xc3, 0x08, 0x8d,
+  0x82, 0x30, 0x94, 0xd1, 0xbb, 0x23, 0x2f, 0x30, 0xe7, 0x4b, 0x4b, 0x9d, 0x91, 0x6f, 0x32, 0x42,
+  0x92, 0x24, 0x0e, 0xac, 0x44, 0x2e, 0x19, 0x21, 0xdc, 0x2b, 0x77, 0x84, 0x1d, 0x9c, 0x88, 0x86,
+  0xf1, 0xe7, 0x09, 0x91, 0x2d, 0xb5, 0xa7, 0xf4, 0x46, 0x5f, 0x77, 0x45, 0xc0, 0x93, 0x27, 0x79,
+  0xdb, 0xea, 0x54, 0x7b, 0xbd, 0x12, 0x93, 0x08, 0xd8, 0xb2, 0x7c, 0x92, 0xab, 0x1a, 0x2a, 0x78,
+  0x93, 0xac, 0x08, 0x35, 0xd8, 0x73, 0xf9, 0xd5, 0x2b, 0x00, 0x38, 0xd0, 0xf4, 0x13, 0x22, 0x8c,
+  0x8d, 0x63, 0x72, 0x41, 0xc5, 0x89, 0xba, 0x66, 0x84, 0x7c, 0x0d, 0x7c, 0x93, 0x01, 0xcc, 0x64,
+  0x27, 0x88, 0x24, 0xa8, 0x61, 0xf4, 0xcf, 0x54, 0x6d, 0xb2, 0x15, 0xa1, 0xdd, 0x14, 0x34, 0xe3,
+  0x41, 0x52, 0x56, 0xe2, 0xd9, 0x34, 0xfe, 0xc6, 0x75, 0x59, 0xad, 0x99, 0x4a, 0xf5, 0x05, 0x74,
+  0x77, 0x22, 0x20, 0xd5, 0x9c, 0x84, 0x29, 0xe2, 0xf5, 0x14, 0xac, 0xab, 0x98, 0x65, 0x3e, 0x2c,
+  0xf0, 0x26, 0x32, 0xe6, 0x25, 0xc2, 0x0a, 0x32, 0x26, 0x78, 0x03, 0x19, 0xeb, 0x2a, 0x5c, 0x99,
+  0x8c, 0x05, 0xde, 0xcc, 0x8d, 0xa9, 0xf0, 0x2d, 0x3e, 0x10, 0xb0, 0x59, 0x1e, 0x6b, 0xaa, 0x4a,
+  0xc0, 0x86, 0xaa, 0xf6, 0x95, 0x9a, 0x32, 0x05, 0x1b, 0xbe, 0x81, 0x50, 0xe9, 0xf6, 0x48, 0x99,
+  0x56, 0x09, 0x65, 0x1b, 0x5f, 0xfa, 0x6a, 0xc2, 0x1a, 0xb6, 0x34, 0x78, 0x03, 0x99, 0x3c, 0xcf,
+  0xbe, 0x4c, 0x23, 0x87, 0x6d, 0x20, 0x90, 0x65, 0x37, 0x95, 0xeb, 0x67, 0xa0, 0x0d, 0xd5, 0xf5,
+  0xf6, 0x73, 0xb9, 0xb6, 0x86, 0xa0, 0xa9, 0x44, 0xcd, 0xb3, 0x91, 0x84, 0xde, 0xad, 0xad, 0x26,
+  0xa3, 0xa1, 0x5b, 0x49, 0x19, 0x09, 0x8a, 0x65, 0x4a, 0x06, 0x70, 0x33, 0x09, 0x9d, 0x66, 0x57,
+  0x49, 0x42, 0x03, 0x37, 0x8a, 0x54, 0x67, 0x8e, 0x57, 0xc9, 0x54, 0xc3, 0x36, 0x10, 0x30, 0x33,
+  0xa0, 0xcb, 0x24, 0x4c, 0xe8, 0x46, 0x22, 0x3a, 0x8b, 0xb7, 0x8a, 0x84, 0x86, 0x6d, 0x9a, 0xf0,
+  0x79, 0x12, 0x54, 0xc5, 0x54, 0xcf, 0x81, 0xdb, 0x48, 0x88, 0xec, 0x91, 0x35, 0x14, 0x04, 0x6c,
+  0x03, 0x81, 0x2c, 0xfb, 0xa4, 0x5c, 0x3f, 0x03, 0xed, 0xb0, 0x66, 0xb3, 0x4c, 0x89, 0xf5, 0x6b,
+  0x36, 0x43, 0x39, 0x2e, 0xd8, 0x73, 0xad, 0xfb, 0x8d, 0x42, 0x98, 0x86, 0xeb, 0xad, 0x7c, 0x6e,
+  0xca, 0xc3, 0x98, 0xfa, 0xca, 0x94, 0xa3, 0x21, 0x1d, 0x31, 0x90, 0xb8, 0x53, 0xdf, 0x97, 0x04,
+  0xbf, 0x56, 0x56, 0xe2, 0x14, 0xfd, 0xb6, 0x82, 0x4b, 0xd0, 0xd8, 0x6b, 0x63, 0xce, 0x01, 0xba,
+  0x47, 0x33, 0xb0, 0xbe, 0x0c, 0x3d, 0x1d, 0xfd, 0xdc, 0xfe, 0x47, 0x8a, 0x0d, 0x69, 0x94, 0xdc,
+  0x5d, 0x80, 0x12, 0x8f, 0x62, 0x0b, 0xc2, 0xb7, 0xcb, 0xc3, 0xc9, 0x18, 0x02, 0x00, 0x51, 0x04,
+  0x7e, 0xa9, 0x80, 0x08, 0x3e, 0xd0, 0xf3, 0xf5, 0xcc, 0x43, 0x82, 0x01, 0x78, 0x35, 0x02, 0x0d,
+  0x6d, 0xab, 0xe1, 0x5e, 0xbe, 0xa0, 0x41, 0x08, 0x01, 0x34, 0x84, 0xd3, 0xd8, 0x1d, 0xbb, 0x8e,
+  0xe5, 0x49, 0xde, 0x8a, 0xce, 0x6f, 0x77, 0x4d, 0xaa, 0xbc, 0x2a, 0x80, 0x8d, 0x59, 0xd1, 0xad,
+  0x2a, 0xfb, 0x49, 0x59, 0x50, 0x81, 0xa7, 0xfd, 0x59, 0xd8, 0x20, 0x5c, 0x1a, 0xe9, 0xa5, 0x7c,
+  0x60, 0x4b, 0x08, 0xfd, 0x75, 0xe4, 0xd0, 0xd0, 0x0f, 0x3f, 0x41, 0xf9, 0xdf, 0x95, 0x6b, 0x66,
+  0x0e, 0xca, 0x16, 0x67, 0x50, 0x1d, 0xeb, 0xdc, 0x35, 0x02, 0x92, 0x22, 0x82, 0xe6, 0xa0, 0xc0,
+  0xf0, 0x04, 0x06, 0xbb, 0xc4, 0x44, 0x15, 0xee, 0x47, 0xa3, 0xb9, 0x67, 0xd9, 0xfb, 0x5d, 0xe8,
+  0x54, 0xfa, 0x0f, 0x48, 0xc8, 0xb4, 0xf8, 0x3b, 0x11, 0xaa, 0xf2, 0x20, 0x80, 0x90, 0x65, 0xf3,
+  0x77, 0x21, 0x54, 0xe9, 0x43, 0x48, 0x8e, 0xce, 0x85, 0xb7, 0xbf, 0x13, 0x2f, 0x56, 0xc0, 0x28,
+  0xe4, 0xb2, 0x73, 0x65, 0xdb, 0x83, 0x80, 0xca, 0xb6, 0xe1, 0xdf, 0x85, 0x46, 0xb5, 0x2b, 0x01,
+  0xa4, 0x4a, 0x76, 0x7f, 0x17, 0x6a, 0x6b, 0xfd, 0x09, 0xcd, 0x5b, 0x7e, 0xf7, 0x72, 0x47, 0xd6,
+  0x8a, 0xde, 0x04, 0x10, 0xca, 0x5d, 0x80, 0x5d, 0xa8, 0x94, 0x9d, 0x09, 0x20, 0x91, 0x79, 0x01,
+  0xbb, 0x50, 0x28, 0x79, 0x13, 0x40, 0x40, 0x3b, 0x02, 0x03, 0xb2, 0xb3, 0x17, 0x21, 0x2b, 0xe5,
+  0xc7, 0xcc, 0x77, 0xf2, 0x1d, 0x9a, 0x7b, 0x86, 0xa5, 0xdf, 0x85, 0xe9, 0x0a, 0xaf, 0xa1, 0x21,
+  0x88, 0x68, 0x5b, 0xbf, 0x23, 0x91, 0xa2, 0xdf, 0x20, 0x84, 0xa7, 0xcd, 0xfd, 0x6e, 0xd2, 0x2b,
+  0x3a, 0x0e, 0x40, 0xc2, 0x34, 0xf7, 0xbb, 0x10, 0xa9, 0x72, 0x1e, 0x04, 0x19, 0x6d, 0xf2, 0x77,
+  0x23, 0x52, 0x74, 0x1e, 0x70, 0x9a, 0xe7, 0x36, 0x7f, 0xa7, 0x09, 0x5e, 0xf6, 0x1f, 0x34, 0x11,
+  0x95, 0x10, 0x2b, 0x68, 0xbc, 0x00, 0x8d, 0xbc, 0x8d, 0x8a, 0xe5, 0x02, 0x00, 0x91, 0xcc, 0xf6,
+  0xef, 0x46, 0xa3, 0xe4, 0x45, 0x18, 0x6b, 0xd6, 0x48, 0x06, 0xdd, 0x7d, 0xcd, 0x96, 0xfc, 0x09,
+  0x20, 0x68, 0x38, 0x08, 0x03, 0x73, 0xd7, 0x65, 0xef, 0xf6, 0xf8, 0x0e, 0xa6, 0xbf, 0x09, 0x56,
+  0x63, 0xca, 0xf8, 0x24, 0x06, 0x7e, 0xea, 0xef, 0xde, 0x5e, 0x5e, 0xd5, 0x61, 0xe8, 0xa0, 0x21,
+  0x96, 0xc0, 0xb8, 0xad, 0xf6, 0xea, 0x2a, 0x7c, 0x6e, 0x5d, 0x2d, 0x67, 0xac, 0x0e, 0x28, 0xf8,
+  0x1d, 0xda, 0xc0, 0x13, 0x0d, 0xed, 0xa3, 0x67, 0x00, 0xe8, 0xb7, 0xa0, 0x3f, 0x62, 0x1f, 0x96,
+  0xeb, 0x7f, 0x5e, 0xbe, 0x7d, 0x83, 0x0e, 0x27, 0xd8, 0xfa, 0x60, 0xb4, 0xd4, 0xdb, 0x09, 0x80,
+  0x70, 0x07, 0xff, 0xc2, 0xa7, 0x9c, 0x4a, 0x5f, 0xc2, 0x70, 0x0a, 0xb0, 0xb0, 0x3d, 0x95, 0x67,
+  0xf0, 0xc2, 0x27, 0xb7, 0xd3, 0x0d, 0xd0, 0x6e, 0xfa, 0x24, 0x9d, 0x7b, 0x1e, 0xa0, 0xe0, 0xf1,
+  0xcf, 0xf2, 0x33, 0xb0, 0x94, 0xa2, 0x92, 0x3c, 0xbe, 0x17, 0x1b, 0x73, 0xca, 0x73, 0xc0, 0xf8,
+  0x5e, 0x3d, 0x41, 0x77, 0x54, 0x25, 0xe9, 0x4f, 0xec, 0xea, 0xd0, 0x40, 0x7b, 0x7f, 0xc0, 0x9d,
+  0x41, 0x2e, 0xb7, 0xb9, 0x33, 0x9b, 0xbc, 0x03, 0x9d, 0x3f, 0xb1, 0xbb, 0x7b, 0x20, 0x76, 0xf8,
+  0xb0, 0xc1, 0x64, 0xea, 0xd4, 0x9f, 0x25, 0x8c, 0x2c, 0xe3, 0x39, 0x88, 0x49, 0x3d, 0x2c, 0x68,
+  0x24, 0x52, 0x20, 0x12, 0x9d, 0x0b, 0xe1, 0xcb, 0x5c, 0x88, 0x2c, 0x07, 0xf4, 0xeb, 0x7a, 0xc3,
+  0x74, 0x23, 0x05, 0xde, 0x96, 0xa9, 0x44, 0xec, 0xa9, 0x44, 0xee, 0x32, 0xf2, 0xda, 0x8d, 0x41,
+  0xb1, 0x97, 0x37, 0xa5, 0x6c, 0xa9, 0xbe, 0x2f, 0xf2, 0x2c, 0x16, 0x85, 0xd8, 0x69, 0xfc, 0x43,
+  0x23, 0x2a, 0xfa, 0xc6, 0xff, 0xc0, 0xa0, 0x4a, 0xe1, 0x6d, 0x73, 0x52, 0x6f, 0xb3, 0xcd, 0xe6,
+  0xef, 0x5e, 0x5e, 0x5e, 0xbd, 0x7d, 0xff, 0xb7, 0x5f, 0x2e, 0x5f, 0xfe, 0xf7, 0x05, 0x78, 0x6c,
+  0xfd, 0x4e, 0x47, 0x43, 0x94, 0xeb, 0x88, 0x6e, 0x9c, 0xb5, 0x7b, 0xf9, 0xd3, 0xdf, 0x9b, 0x84,
+  0x67, 0x99, 0x06, 0xf2, 0x3d, 0x35, 0x0e, 0xf4, 0x65, 0x49, 0x02, 0x66, 0x14, 0x9f, 0xc8, 0xad,
+  0xdc, 0xf3, 0xc3, 0x5f, 0x06, 0xc1, 0xdf, 0x41, 0xbc, 0x80, 0x7d, 0x3a, 0x25, 0x23, 0x1a, 0x62,
+  0xdc, 0x92, 0x45, 0x0a, 0x9e, 0x3c, 0x36, 0xbb, 0x14, 0xfa, 0xdf, 0x70, 0x25, 0x17, 0xb0, 0x54,
+  0x48, 0xc4, 0x16, 0xe4, 0x47, 0x36, 0xbc, 0x8c, 0xbd, 0x0f, 0x8c, 0x83, 0xc9, 0x4b, 0x07, 0xfb,
+  0xfb, 0x38, 0xdc, 0x61, 0x2c, 0xd7, 0x7d, 0x7b, 0x82, 0xdb, 0xbf, 0x4f, 0x48, 0x7d, 0x7f, 0x21,
+  0xc4, 0xbc, 0x48, 0xdb, 0xc3, 0x20, 0xa2, 0xc9, 0x12, 0x75, 0x04, 0x6e, 0xfb, 0xd1, 0x24, 0xa1,
+  0xcb, 0xe1, 0x7c, 0x34, 0x02, 0x45, 0x2c, 0xc0, 0x71, 0x14, 0xcf, 0x18, 0xc6, 0x36, 0xfa, 0x48,
+  0x64, 0x8b, 0x45, 0x92, 0x72, 0x86, 0x89, 0x6e, 0x6f, 0xe0, 0xd5, 0x31, 0xd7, 0x05, 0x28, 0xde,
+  0x2a, 0xa2, 0x5e, 0x18, 0xe3, 0x8c, 0xfa, 0x58, 0xaa, 0xe7, 0x41, 0xaa, 0xe4, 0x01, 0x63, 0xda,
+  0x02, 0xe1, 0xf3, 0x64, 0x29, 0x0f, 0x14, 0xeb, 0xb8, 0xed, 0xc7, 0xf1, 0xac, 0x3a, 0x9e, 0x73,
+  0xc7, 0x12, 0x5a, 0x93, 0xb8, 0x9d, 0x4e, 0xa7, 0x91, 0x33, 0xa3, 0xd5, 0x13, 0xb0, 0xc3, 0x70,
+  0x6d, 0x5a, 0x07, 0x6c, 0xf8, 0xfb, 0x37, 0x94, 0x64, 0x31, 0x23, 0xe7, 0x07, 0x78, 0x95, 0x58,
+  0x6d, 0xd4, 0x52, 0xea, 0x2c, 0x01, 0x91, 0xda, 0xc3, 0x25, 0x67, 0xaf, 0xb2, 0x13, 0x9d, 0x43,
+  0xd4, 0x76, 0xa2, 0x1c, 0xba, 0xf4, 0x7d, 0x10, 0xf1, 0x23, 0xa7, 0xd3, 0x20, 0x9f, 0x81, 0x36,
+  0xeb, 0x36, 0x88, 0xde, 0x4a, 0x97, 0x4d, 0x8c, 0x42, 0x3a, 0xc6, 0xd1, 0xb3, 0xb1, 0xbb, 0x8a,
+  0xb6, 0x23, 0xc1, 0x67, 0x67, 0xe4, 0x50, 0xd6, 0x2f, 0x46, 0x80, 0x19, 0xb5, 0xb9, 0xb8, 0x48,
+  0x8f, 0x92, 0x76, 0x56, 0xe8, 0x93, 0xbc, 0x9f, 0x47, 0x11, 0x7e, 0xbe, 0x9a, 0x28, 0x12, 0x7f,
+  0xc1, 0xa6, 0x91, 0x42, 0xa7, 0xb9, 0x67, 0xce, 0x4b, 0xb3, 0xdd, 0x6e, 0xdf, 0x71, 0x61, 0xd6,
+  0x26, 0xd2, 0x25, 0xb1, 0x26, 0x6b, 0x01, 0xed, 0x30, 0x43, 0x93, 0x33, 0xb8, 0x00, 0xee, 0xe7,
+  0x60, 0x63, 0x49, 0x68, 0x24, 0x61, 0x85, 0x0f, 0x5c, 0xa7, 0x9b, 0x37, 0x16, 0xea, 0xfc, 0x87,
+  0x0a, 0xac, 0x9c, 0x18, 0xcf, 0xb3, 0x0f, 0xca, 0x78, 0x6e, 0x47, 0xe1, 0xc9, 0xc5, 0x6b, 0x45,
+  0xd8, 0x86, 0x70, 0xc4, 0xc0, 0x6d, 0x9a, 0x74, 0x76, 0x32, 0x53, 0x69, 0xda, 0x09, 0xf3, 0xb4,
+  0xf6, 0x30, 0x94, 0xfc, 0xfe, 0xdb, 0xa6, 0x7d, 0x27, 0x3b, 0xfd, 0xa8, 0x9a, 0x76, 0x3e, 0x38,
+  0x5b, 0x08, 0x99, 0xe9, 0x41, 0xd5, 0xa4, 0xcc, 0x21, 0xdc, 0x42, 0x0c, 0xcf, 0xf9, 0xd7, 0xf4,
+  0x15, 0x20, 0x9b, 0x4f, 0x42, 0x5e, 0x3d, 0xb0, 0xc4, 0xb2, 0x0c, 0x9e, 0x6a, 0xd2, 0xf9, 0x64,
+  0x47, 0x1f, 0x41, 0x3d, 0x0a, 0x2f, 0xe1, 0x92, 0xc7, 0xb3, 0x19, 0xf3, 0xb7, 0xd1, 0xcf, 0x92,
+  0x6f, 0x4a, 0xf4, 0xa5, 0x07, 0x93, 0x4d, 0x4e, 0xf2, 0x25, 0x68, 0xfe, 0x46, 0xb1, 0x03, 0xfb,
+  0x10, 0x70, 0x6e, 0x1d, 0xf4, 0x7c, 0xe6, 0x96, 0x1a, 0xc1, 0x9c, 0x43, 0x0a, 0x03, 0xae, 0xf6,
+  0x86, 0xe4, 0x24, 0xc8, 0xf1, 0x1b, 0x77, 0x90, 0x8e, 0x71, 0xd0, 0xbf, 0x57, 0x21, 0x9b, 0x52,
+  0xa6, 0x0e, 0xb1, 0x3f, 0xee, 0x2e, 0x84, 0xb6, 0x06, 0x49, 0x9d, 0xbd, 0xd7, 0x37, 0xee, 0xa3,
+  0xac, 0xf6, 0xcc, 0x9d, 0x14, 0x79, 0xa8, 0x87, 0x7c, 0x88, 0x57, 0xa5, 0xd2, 0x2c, 0x0c, 0x7d,
+  0x78, 0x69, 0x19, 0x58, 0x7b, 0x3f, 0xa6, 0x9d, 0x4e, 0x82, 0x11, 0x97, 0x5b, 0x66, 0x58, 0xff,
+  0x33, 0xd3, 0x46, 0x36, 0xe4, 0xe6, 0x89, 0x69, 0x33, 0x51, 0x07, 0xe0, 0x9e, 0xdb, 0x3f, 0xc1,
+  0xb1, 0xe0, 0xcf, 0x22, 0xbc, 0xd8, 0x0a, 0x62, 0x7d, 0x01, 0xd3, 0x18, 0x16, 0x7f, 0x42, 0x17,
+  0x22, 0xef, 0x48, 0x1d, 0x6d, 0xe7, 0xa7, 0x69, 0xf6, 0x18, 0xa4, 0x0c, 0xfa, 0xe7, 0xa7, 0xda,
+  0x19, 0x53, 0xaf, 0x78, 0xa0, 0xab, 0x15, 0x2e, 0xa9, 0xb7, 0x5a, 0x75, 0xad, 0xc3, 0x51, 0x7f,
+  0x1b, 0xa7, 0x95, 0xba, 0xb6, 0x06, 0xcf, 0xa8, 0x8f, 0x73, 0x29, 0x12, 0xa6, 0xe5, 0x52, 0xf8,
+  0xd9, 0xf0, 0xd2, 0x86, 0x62, 0xf1, 0x1d, 0x02, 0xd4, 0xb9, 0xf5, 0x4e, 0x5d, 0x89, 0x07, 0x5b,
+  0x39, 0x00, 0x41, 0x67, 0x0d, 0x09, 0xc2, 0xa3, 0x30, 0x06, 0xaf, 0x27, 0x25, 0xfb, 0x38, 0x01,
+  0x71, 0xd6, 0x0d, 0x44, 0x82, 0x05, 0x85, 0xc6, 0xc8, 0x17, 0x58, 0xa6, 0x4f, 0x68, 0x8b, 0xe8,
+  0x92, 0x94, 0x59, 0xa1, 0x82, 0xde, 0x17, 0xeb, 0xa9, 0x1a, 0x32, 0xca, 0x84, 0xe7, 0x54, 0x48,
+  0x5d, 0x79, 0x2a, 0x6a, 0x67, 0x4b, 0x66, 0x7a, 0x6d, 0x38, 0x80, 0xcc, 0x12, 0xc0, 0xea, 0x99,
+  0x94, 0x3c, 0x2e, 0x8e, 0xbf, 0x44, 0x55, 0xc4, 0x17, 0x0b, 0xe4, 0x06, 0x1c, 0x19, 0xd7, 0x17,
+  0x48, 0x12, 0x20, 0xbe, 0xea, 0x9d, 0xe3, 0x81, 0xff, 0x0c, 0x34, 0x7f, 0xc4, 0x42, 0x4d, 0x67,
+  0x91, 0x43, 0xd5, 0xaf, 0xc7, 0x32, 0xf0, 0x65, 0xe2, 0x18, 0xa0, 0xf2, 0x1b, 0xa8, 0xcb, 0x68,
+  0xf2, 0x1e, 0xac, 0xa9, 0x03, 0x96, 0x03, 0xfe, 0x5f, 0x00, 0x66, 0x43, 0x82, 0xc0, 0xf1, 0x88,
+  0x3f, 0xb0, 0x4b, 0x4c, 0x92, 0x42, 0x4f, 0x43, 0x7d, 0x25, 0xdf, 0x3c, 0x16, 0x0d, 0xa0, 0xbc,
+  0x7b, 0x0c, 0x3f, 0x4e, 0xc8, 0x21, 0xfc, 0x50, 0x47, 0xa0, 0x50, 0x75, 0xc8, 0xc6, 0x41, 0xf4,
+  0x0e, 0x64, 0xec, 0x28, 0x5a, 0x98, 0x99, 0x72, 0x15, 0x63, 0x1b, 0x13, 0xd0, 0x1f, 0x01, 0x88,
+  0xfc, 0x50, 0x41, 0x30, 0x77, 0x05, 0x20, 0x8b, 0x32, 0x44, 0xb6, 0x2f, 0xe7, 0xbc, 0xec, 0xd5,
+  0x94, 0xde, 0xe0, 0x77, 0x21, 0x71, 0x1e, 0xfd, 0xd1, 0x6d, 0x3d, 0xf4, 0x49, 0xdc, 0x1e, 0x0c,
+  0xf4, 0x97, 0xa4, 0xdb, 0x76, 0xb3, 0xc9, 0x19, 0xc6, 0x42, 0xd3, 0x49, 0x4f, 0xbc, 0x89, 0x0d,
+  0x35, 0x89, 0xc8, 0x0b, 0xd3, 0x9e, 0x50, 0x49, 0x1e, 0x02, 0x7a, 0x5c, 0xee, 0xad, 0x24, 0x91,
+  0xe7, 0x2c, 0x5d, 0x17, 0xf3, 0x95, 0x70, 0x80, 0x17, 0xaa, 0xab, 0x8e, 0xe5, 0x52, 0xb7, 0x44,
+  0x5e, 0x8d, 0xc4, 0x42, 0x5f, 0x7a, 0x02, 0x25, 0x28, 0x14, 0x31, 0x59, 0x41, 0xbf, 0x3a, 0xd7,
+  0x50, 0x45, 0xb0, 0xa6, 0x3d, 0xa3, 0x40, 0x67, 0x6d, 0x18, 0x32, 0x06, 0x30, 0xa8, 0x4b, 0xc2,
+  0x60, 0x2a, 0x12, 0x43, 0xc0, 0xb2, 0x58, 0x7a, 0xf3, 0xb6, 0x70, 0x8f, 0xf7, 0xb0, 0xfb, 0x4e,
+  0x39, 0x83, 0xa4, 0xa9, 0x05, 0x0e, 0x4b, 0x53, 0x65, 0xfc, 0xe1, 0x24, 0xb4, 0xb0, 0x73, 0x43,
+  0xdd, 0xc4, 0x74, 0x0d, 0xc4, 0x94, 0x09, 0x7d, 0x25, 0x4c, 0xd3, 0x0e, 0x67, 0xb8, 0x32, 0x73,
+  0xaf, 0x84, 0x8b, 0xe6, 0x36, 0xc3, 0x91, 0x89, 0x79, 0x22, 0x20, 0x29, 0x6c, 0x48, 0x17, 0x22,
+  0x01, 0x23, 0x46, 0x30, 0x02, 0x1e, 0xe5, 0xdb, 0x36, 0x45, 0x4a, 0x95, 0x91, 0x1f, 0x20, 0xa0,
+  0x17, 0xe1, 0xa6, 0x05, 0x6a, 0xe5, 0xcf, 0x8b, 0x73, 0x74, 0x55, 0xa9, 0x60, 0xbc, 0x54, 0x13,
+  0x06, 0xdc, 0x4a, 0x36, 0x2b, 0x25, 0xdc, 0xcf, 0x5a, 0xae, 0xce, 0xe9, 0xac, 0xcb, 0x81, 0xe4,
+  0x22, 0xfa, 0xc8, 0x03, 0x7d, 0xb1, 0xa5, 0x6f, 0x11, 0xc3, 0x70, 0x19, 0x63, 0x67, 0xa7, 0x9e,
+  0xff, 0x8e, 0x0f, 0x8c, 0xd6, 0xcc, 0xdf, 0x5a, 0x22, 0x64, 0x24, 0x47, 0x7e, 0x63, 0xf5, 0xec,
+  0x17, 0x7b, 0x64, 0x04, 0xb2, 0xeb, 0x69, 0x52, 0xcc, 0x15, 0x75, 0x13, 0x91, 0x5d, 0xe6, 0xd4,
+  0xe5, 0x65, 0x01, 0x99, 0x54, 0x90, 0x45, 0x17, 0x3a, 0x88, 0x59, 0xd7, 0x66, 0x5e, 0xe9, 0xb6,
+  0x49, 0x0e, 0x54, 0xec, 0x71, 0xb2, 0xaf, 0x52, 0x1b, 0x4f, 0xf6, 0xd5, 0x35, 0x29, 0xf1, 0x6b,
+  0x02, 0xff, 0x0f, 0x30, 0x98, 0x0a, 0xa6, 0x36, 0x70, 0x00, 0x00,
+};
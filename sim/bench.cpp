@@ -0,0 +1,120 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <vector>
+#include "control.h"
+#include "adcfilter.h"
+#include "hal.h"
+#include "metrics.h"
+#include "plant.h"
+
+// Host microbenchmarks for the pure computation paths of the control loop.
+// Each benchmark runs in batches; the table reports ns/op over batches so
+// regressions show up in the average and the tail.
+//
+//   g++ -std=c++17 -O2 -Igaugecontrol -Isim gaugecontrol/control.cpp
+//       gaugecontrol/metrics.cpp sim/hal_sim.cpp sim/bench.cpp -o gaugebench
+//   ./gaugebench [--batches N]
+
+#define BATCH_SIZE 1000
+
+static volatile uint32_t sink;
+static int batches = 2000;
+
+// Returns the average ns/op
+template <typename Op>
+static double bench(const char *name, Op op) {
+    std::vector<double> nsPerOp;
+    nsPerOp.reserve(batches);
+
+    // Warm up caches and branch predictors
+    for (int i = 0; i < BATCH_SIZE; i++) op(i);
+
+    for (int b = 0; b < batches; b++) {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < BATCH_SIZE; i++) op(i);
+        auto end = std::chrono::steady_clock::now();
+        nsPerOp.push_back(std::chrono::duration<double, std::nano>(end - start).count() / BATCH_SIZE);
+    }
+
+    std::sort(nsPerOp.begin(), nsPerOp.end());
+    double total = 0;
+    for (double v : nsPerOp) total += v;
+
+    printf("%-28s %9.2f %9.2f %9.2f %9.2f\n", name,
+           nsPerOp.front(), total / nsPerOp.size(),
+           nsPerOp[(nsPerOp.size() * 99) / 100], nsPerOp.back());
+    return total / nsPerOp.size();
+}
+
+int main(int argc, char **argv) {
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--batches") && i + 1 < argc) {
+            batches = atoi(argv[++i]);
+        } else {
+            fprintf(stderr, "usage: %s [--batches N]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    uint16_t window[ADC_WINDOW_MAX];
+    for (int i = 0; i < ADC_WINDOW_MAX; i++) {
+        window[i] = 1500 + (uint16_t)(plant.random() * 200);
+    }
+
+    halBegin();
+    controlBegin();
+    for (Tank &tank : plant.tanks) tank.h2Signal = true;
+
+    printf("%-28s %9s %9s %9s %9s\n", "# ns/op", "min", "avg", "p99", "max");
+
+    bench("resistance_from_mv", [](int i) {
+        sink = (uint32_t)resistanceFromMillivolts(0, 200 + (i & 1023) * 2);
+    });
+    bench("sensor_lookup", [](int i) {
+        sink = sensorLookup(0, 200 + (i & 1023) * 2).dutyQ8;
+    });
+    bench("level_estimator", [](int i) {
+        static LevelEstimator estimator = {};
+        estimatorUpdate(estimator, 200 + (i & 7), 1.0, 0.005, DEFAULT_LEVEL_NOISE, DEFAULT_RATE_NOISE);
+        sink = (uint32_t)estimator.level;
+    });
+    bench("adc_filter_median_10", [&](int i) {
+        sink = filterAdcWindow(window + (i & 63), 10, ADC_FILTER_MEDIAN);
+    });
+    bench("adc_filter_trimmed_10", [&](int i) {
+        sink = filterAdcWindow(window + (i & 63), 10, ADC_FILTER_TRIMMED_MEAN);
+    });
+    bench("adc_filter_trimmed_100", [&](int) {
+        sink = filterAdcWindow(window, ADC_WINDOW_MAX, ADC_FILTER_TRIMMED_MEAN);
+    });
+    bench("metrics_record", [](int i) {
+        metricsRecord(METRIC_TELEMETRY, 100 + (i & 4095));
+    });
+    bench("table_rebuild", [](int) {
+        controlSetSettings(0, ChannelSettings());
+    });
+
+    // The whole step for each channel count; the step has to fit in
+    // CONTROL_PERIOD_MS with every configured channel
+    double stepNs[MAX_CHANNELS + 1] = {};
+    for (int n = 1; n <= MAX_CHANNELS; n++) {
+        char name[32];
+        snprintf(name, sizeof(name), "control_step_%dch", n);
+        channelCount = n;
+        stepNs[n] = bench(name, [](int) {
+            plant.advance(CONTROL_PERIOD_MS * 1000);
+            controlStep();
+            sink = plant.tanks[0].psDuty;
+        });
+    }
+
+    printf("\n%-28s %9s %12s\n", "# channels", "us/step", "max rate Hz");
+    for (int n = 1; n <= MAX_CHANNELS; n++) {
+        printf("%-28d %9.3f %12.0f\n", n, stepNs[n] / 1000, 1e9 / stepNs[n]);
+    }
+
+    return 0;
+}
@@ -0,0 +1,448 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "control.h"
+#include "hal.h"
+#include "metrics.h"
+#include "plant.h"
+
+// Closed-loop host simulation: runs controlStep() against the plant model
+// in faster-than-real time while cycling H2, draining and refilling each
+// channel's tank on its own schedule, and checks the timing/safety
+// invariants of every channel on every step.
+//
+//   g++ -std=c++17 -O2 -Igaugecontrol -Isim gaugecontrol/control.cpp
+//       gaugecontrol/metrics.cpp sim/hal_sim.cpp sim/gaugesim.cpp -o gaugesim
+//   ./gaugesim [--hours N] [--seed N] [--channels N] [--filter ema|kalman]
+//              [--no-glitches] [--polling] [--verbose] [--log FILE]
+//
+// --log writes every logged sample in the device's /log format, so the
+// output can be checked with tools/logdecode. --filter picks the needle
+// filter; the needle error is measured against the noise-free level.
+// Unless --no-glitches is given, the H2 inputs also pick up short pulses
+// of coil-plug noise to exercise the debounce and glitch filter.
+// --polling runs without the H2 edge interrupt, as the ESP32 does when it
+// cannot be installed; H2 off must then cut the PS within one step.
+//
+// Before the random schedule, fixed scenarios abort a ramp halfway, by an
+// H2 drop and by a low level, with the interrupt and with polling, and
+// check that the PS is at 0 by the end of the step that sees the cause.
+
+#define REFILL_DELAY_S 60  // Operator refills this long after a low-level trip
+#define H2_ON_MIN_S 120
+#define H2_ON_MAX_S 1200
+#define H2_OFF_MIN_S 30
+#define H2_OFF_MAX_S 300
+#define DRY_MARGIN_DUTY 1  // True level this far under the threshold with PS on is a violation
+#define H2_GLITCH_MIN_S 30 // Time between noise pulses on an H2 input
+#define H2_GLITCH_MAX_S 300
+#define SCENARIO_SETTLE_S 2      // Needle settling before H2 comes on
+#define SCENARIO_TIMEOUT_S 30    // A scenario stage that takes longer fails
+
+static int violations = 0;
+
+static void violation(int ch, const char *what) {
+    violations++;
+    if (violations <= 20) {
+        Tank &tank = plant.tanks[ch];
+        printf("VIOLATION at %.3f s on channel %d: %s (ps=%d smoothed=%d level=%.3f)\n",
+               plant.timeUs / 1e6, ch, what, tank.psDuty, (int)channels[ch].smoothedDuty, tank.level);
+    }
+}
+
+static uint64_t randomDurationUs(int minS, int maxS) {
+    return (uint64_t)((minS + plant.random() * (maxS - minS)) * 1e6);
+}
+
+// Per-channel schedule and results
+struct SimChannel {
+    uint64_t nextH2EdgeUs;
+    uint64_t nextGlitchUs;
+    bool glitchEndPending;
+    bool h2Pin;                       // Input level the interrupt last saw
+    uint64_t h2PinHighSinceUs, h2PinLowSinceUs;
+    PemState lastPemState;
+    bool wasLockout;
+    uint64_t lowSinceUs;
+    unsigned long h2Cycles, pemStarts, glitches, lowLevelTrips, refills;
+    unsigned long h2Drops, h2Cutoffs;     // On to off input changes, PS cuts by the interrupt
+    bool h2FallPending;                   // Polling: H2 fell with the PS driven, not cut yet
+    uint64_t h2FellAtUs;
+    double errorSquares, maxError;
+    unsigned long errorSamples;
+};
+
+enum SimEvent { EVENT_H2_EDGE, EVENT_GLITCH_START, EVENT_GLITCH_END };
+
+static uint64_t nextEventUs(const SimChannel &sim, const Tank &tank, SimEvent &event) {
+    uint64_t t = sim.nextH2EdgeUs;
+    event = EVENT_H2_EDGE;
+    if (sim.nextGlitchUs < t) {
+        t = sim.nextGlitchUs;
+        event = EVENT_GLITCH_START;
+    }
+    if (sim.glitchEndPending && tank.glitchEndUs < t) {
+        t = tank.glitchEndUs;
+        event = EVENT_GLITCH_END;
+    }
+    return t;
+}
+
+// Let the interrupt see a change of the input, and note when it changed
+static void h2PinChanged(int ch, SimChannel &sim) {
+    bool level = plant.h2Level(ch);
+    if (level == sim.h2Pin) return;
+    sim.h2Pin = level;
+    (level ? sim.h2PinHighSinceUs : sim.h2PinLowSinceUs) = plant.timeUs;
+
+    if (simH2Interrupt(ch)) sim.h2Cutoffs++;
+
+    // A glitch can end while the interrupt polls; it records that edge itself
+    if (plant.h2Level(ch) != sim.h2Pin) {
+        sim.h2Pin = !sim.h2Pin;
+        (sim.h2Pin ? sim.h2PinHighSinceUs : sim.h2PinLowSinceUs) = plant.timeUs;
+    }
+}
+
+// Fresh plant, HAL and control state, as after a power-up
+static void resetSim(int filter, uint32_t seed) {
+    plant = Plant();
+    plant.rng = seed;
+    for (int ch = 0; ch < MAX_CHANNELS; ch++) channels[ch] = Channel();
+
+    halBegin();
+    controlBegin();
+
+    ChannelSettings settings;
+    settings.levelFilter = filter;
+    for (int ch = 0; ch < MAX_CHANNELS; ch++) controlSetSettings(ch, settings);
+    metricsReset();
+}
+
+static void runStep() {
+    plant.advance(CONTROL_PERIOD_MS * 1000ULL);
+    controlStep();
+}
+
+enum RampAbort { ABORT_H2_DROP, ABORT_LOW_LEVEL };
+
+// Start a ramp on channel 0, abort it halfway a third of the way into a
+// control period, and check that the PS is at 0 by the end of the step
+// that sees the cause. Returns the cause-to-PS=0 time.
+static uint64_t rampAbortScenario(RampAbort abort, int filter) {
+    const uint64_t periodUs = CONTROL_PERIOD_MS * 1000ULL;
+    const uint64_t timeoutUs = SCENARIO_TIMEOUT_S * 1000000ULL;
+    Tank &tank = plant.tanks[0];
+    Channel &channel = channels[0];
+
+    resetSim(filter, 1);
+    while (plant.timeUs < SCENARIO_SETTLE_S * 1000000ULL) runStep();
+
+    tank.h2Signal = true;
+    simH2Interrupt(0);
+    uint64_t startUs = plant.timeUs;
+    while (channel.pemState != PEM_RAMPING || channel.rampValue < channel.settings.pemMaxValue / 2) {
+        if (plant.timeUs - startUs > timeoutUs) {
+            violation(0, "scenario ramp did not reach halfway");
+            return 0;
+        }
+        runStep();
+    }
+    if (tank.psDuty == 0) violation(0, "scenario ramp not driving the PS");
+
+    plant.advance(periodUs / 3);
+    uint64_t causeUs = plant.timeUs;
+    if (abort == ABORT_H2_DROP) {
+        tank.h2Signal = false;
+        if (simH2Interrupt(0) && tank.psDuty == 0) return plant.timeUs - causeUs;
+
+        // Polling: the next step has to see the drop and cut
+        plant.advance(periodUs - periodUs / 3);
+        controlStep();
+        if (tank.psDuty != 0 || channel.pemState != PEM_IDLE) {
+            violation(0, "ramp not aborted in the step after H2 off");
+        }
+        return plant.timeUs - causeUs;
+    }
+
+    // The sender reads empty from here on; the ramp must stop in the step
+    // that trips the low-level lockout, whenever the filter gets there
+    tank.level = 0;
+    plant.advance(periodUs - periodUs / 3);
+    for (;;) {
+        controlStep();
+        if (channel.lowLevelLockout) {
+            if (tank.psDuty != 0 || channel.pemState != PEM_IDLE) {
+                violation(0, "ramp not aborted in the step that tripped low level");
+            }
+            return plant.timeUs - causeUs;
+        }
+        if (plant.timeUs - causeUs > timeoutUs) {
+            violation(0, "scenario low level never tripped");
+            return 0;
+        }
+        plant.advance(periodUs);
+    }
+}
+
+static void runScenarios(int filter) {
+    FILE *logFile = simLogFile;  // Scenarios are not part of the --log output
+    simLogFile = NULL;
+    bool polling = simH2Polling;
+
+    for (int path = 0; path < 2; path++) {
+        simH2Polling = (path == 1);
+        const char *pathName = simH2Polling ? "polling" : "interrupt";
+        uint64_t h2Us = rampAbortScenario(ABORT_H2_DROP, filter);
+        printf("ramp abort by H2 drop (%s): PS=0 %.3f ms after the edge\n", pathName, h2Us / 1000.0);
+        if (h2Us > CONTROL_PERIOD_MS * 1000ULL + h2GlitchUs) {
+            violation(0, "H2 drop took longer than one control step");
+        }
+        uint64_t lowUs = rampAbortScenario(ABORT_LOW_LEVEL, filter);
+        printf("ramp abort by low level (%s): PS=0 %.3f ms after the sender read empty\n", pathName, lowUs / 1000.0);
+    }
+
+    simH2Polling = polling;
+    simLogFile = logFile;
+}
+
+int main(int argc, char **argv) {
+    double hours = 8;
+    int filter = DEFAULT_LEVEL_FILTER;
+    bool glitches = true;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--hours") && i + 1 < argc) {
+            hours = atof(argv[++i]);
+        } else if (!strcmp(argv[i], "--seed") && i + 1 < argc) {
+            plant.rng = (uint32_t)atol(argv[++i]);
+        } else if (!strcmp(argv[i], "--channels") && i + 1 < argc) {
+            channelCount = atoi(argv[++i]);
+            if (channelCount < 1 || channelCount > MAX_CHANNELS) {
+                fprintf(stderr, "channels must be 1..%d\n", MAX_CHANNELS);
+                return 2;
+            }
+        } else if (!strcmp(argv[i], "--filter") && i + 1 < argc) {
+            i++;
+            if (!strcmp(argv[i], "ema")) {
+                filter = LEVEL_FILTER_EMA;
+            } else if (!strcmp(argv[i], "kalman")) {
+                filter = LEVEL_FILTER_KALMAN;
+            } else {
+                fprintf(stderr, "unknown filter %s\n", argv[i]);
+                return 2;
+            }
+        } else if (!strcmp(argv[i], "--no-glitches")) {
+            glitches = false;
+        } else if (!strcmp(argv[i], "--polling")) {
+            simH2Polling = true;
+        } else if (!strcmp(argv[i], "--verbose")) {
+            simVerbose = true;
+        } else if (!strcmp(argv[i], "--log") && i + 1 < argc) {
+            simLogFile = fopen(argv[++i], "wb");
+            if (simLogFile == NULL) {
+                perror(argv[i]);
+                return 2;
+            }
+        } else {
+            fprintf(stderr, "usage: %s [--hours N] [--seed N] [--channels N] [--filter ema|kalman] [--no-glitches] [--polling] [--verbose] [--log FILE]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    const uint64_t periodUs = CONTROL_PERIOD_MS * 1000ULL;
+    const uint64_t endUs = (uint64_t)(hours * 3600e6);
+    const uint64_t watchdogLimitUs = (WATCHDOG_INTERVAL + CONTROL_PERIOD_MS) * 1000ULL;
+    const uint64_t debounceUs = h2DebounceMs * 1000ULL;
+
+    uint32_t seed = plant.rng;
+    runScenarios(filter);
+    resetSim(filter, seed);
+
+    // Tanks drain at different rates so the channels drift out of step
+    SimChannel sims[MAX_CHANNELS] = {};
+    for (int ch = 0; ch < channelCount; ch++) {
+        plant.tanks[ch].consumptionPerSec *= 1.0 + 0.25 * ch;
+        sims[ch].nextH2EdgeUs = randomDurationUs(1, 10);
+        sims[ch].nextGlitchUs = glitches ? randomDurationUs(H2_GLITCH_MIN_S, H2_GLITCH_MAX_S) : UINT64_MAX;
+    }
+    uint64_t maxH2LatencyUs = 0;
+    unsigned long steps = 0;
+
+    clock_t wallStart = clock();
+
+    while (plant.timeUs < endUs) {
+        uint64_t stepEndUs = plant.timeUs + periodUs;
+
+        // H2 edges and glitches land anywhere inside the step, not only on
+        // step boundaries, and are applied in time order across channels
+        for (;;) {
+            int next = -1;
+            SimEvent event = EVENT_H2_EDGE;
+            uint64_t eventUs = 0;
+            for (int ch = 0; ch < channelCount; ch++) {
+                SimEvent e;
+                uint64_t t = nextEventUs(sims[ch], plant.tanks[ch], e);
+                if (t < stepEndUs && (next < 0 || t < eventUs)) {
+                    next = ch;
+                    event = e;
+                    eventUs = t;
+                }
+            }
+            if (next < 0) break;
+
+            SimChannel &sim = sims[next];
+            Tank &tank = plant.tanks[next];
+            // An interrupt polling the pin may already have run past it
+            if (eventUs > plant.timeUs) plant.advance(eventUs - plant.timeUs);
+
+            if (event == EVENT_H2_EDGE) {
+                tank.h2Signal = !tank.h2Signal;
+                if (tank.h2Signal) {
+                    sim.h2Cycles++;
+                    sim.nextH2EdgeUs += randomDurationUs(H2_ON_MIN_S, H2_ON_MAX_S);
+                    h2PinChanged(next, sim);
+                } else {
+                    // H2 off must zero the power supply from the interrupt
+                    uint64_t fellAtUs = plant.timeUs;
+                    bool driven = tank.psDuty != 0;
+                    sim.h2Drops++;
+                    sim.nextH2EdgeUs += randomDurationUs(H2_OFF_MIN_S, H2_OFF_MAX_S);
+                    h2PinChanged(next, sim);
+                    if (simH2Polling) {
+                        // Cut by the next control step; checked after it
+                        sim.h2FallPending = driven;
+                        sim.h2FellAtUs = fellAtUs;
+                    } else {
+                        if (driven && tank.psDuty != 0) violation(next, "PS still driven after H2 off edge");
+                        uint64_t latency = plant.timeUs - fellAtUs;
+                        if (driven && latency > maxH2LatencyUs) maxH2LatencyUs = latency;
+                    }
+                }
+            } else if (event == EVENT_GLITCH_START) {
+                // Pulses against the current level, drops while on and spikes while
+                // off, mostly but not always shorter than the filter meant for them
+                double r = plant.random();
+                uint64_t widthUs = 1 + (uint64_t)(r * r * r * 2 * (tank.h2Signal ? h2GlitchUs : debounceUs));
+                sim.nextGlitchUs += randomDurationUs(H2_GLITCH_MIN_S, H2_GLITCH_MAX_S);
+                if (plant.timeUs + widthUs < sim.nextH2EdgeUs) {
+                    tank.glitchStartUs = plant.timeUs;
+                    tank.glitchEndUs = plant.timeUs + widthUs;
+                    sim.glitchEndPending = true;
+                    sim.glitches++;
+                    // A drop longer than the glitch filter is a real H2 off, and a
+                    // spike that outlasts the debounce time ends with one
+                    if (widthUs > (uint64_t)(tank.h2Signal ? h2GlitchUs : debounceUs - 1)) sim.h2Drops++;
+                    h2PinChanged(next, sim);
+                }
+            } else {
+                sim.glitchEndPending = false;
+                h2PinChanged(next, sim);
+            }
+        }
+        if (stepEndUs > plant.timeUs) plant.advance(stepEndUs - plant.timeUs);
+
+        controlStep();
+        steps++;
+
+        for (int ch = 0; ch < channelCount; ch++) {
+            SimChannel &sim = sims[ch];
+            Tank &tank = plant.tanks[ch];
+            Channel &channel = channels[ch];
+
+            // The input low for longer than the glitch filter keeps the PS off
+            bool h2Low = !plant.h2Level(ch) && plant.timeUs - sim.h2PinLowSinceUs > (uint64_t)h2GlitchUs;
+            if (h2Low && tank.psDuty != 0) violation(ch, "PS driven while H2 off");
+
+            if (sim.h2FallPending) {
+                sim.h2FallPending = false;
+                if (tank.psDuty != 0) violation(ch, "PS still driven one step after H2 off");
+                uint64_t latency = plant.timeUs - sim.h2FellAtUs;
+                if (latency > maxH2LatencyUs) maxH2LatencyUs = latency;
+            }
+
+            // The PEM only starts once the input has been high for the debounce time
+            if (sim.lastPemState == PEM_IDLE && channel.pemState != PEM_IDLE) {
+                sim.pemStarts++;
+                if (!plant.h2Level(ch) || plant.timeUs - sim.h2PinHighSinceUs < debounceUs) {
+                    violation(ch, "PEM started before H2 was stable");
+                }
+            }
+            sim.lastPemState = channel.pemState;
+
+            // Low level must keep the power supply off, by the needle and by the true level
+            int threshold = channel.settings.lowLevelThreshold;
+            bool isLow = (int)channel.smoothedDuty < threshold;
+            if (isLow && tank.psDuty != 0) violation(ch, "PS driven below low level threshold");
+
+            double trueDuty = sensorLookup(ch, plant.trueMillivolts(ch)).dutyQ8 / 256.0;
+            if (tank.psDuty != 0 && trueDuty < threshold - DRY_MARGIN_DUTY) {
+                violation(ch, "PS driven with the true level below threshold");
+            }
+            if (channel.lowLevelLockout && !sim.wasLockout) {
+                sim.lowLevelTrips++;
+                sim.lowSinceUs = plant.timeUs;
+            }
+            sim.wasLockout = channel.lowLevelLockout;
+
+            // Needle error once the boot transient has settled
+            if (plant.timeUs > 10000000ULL) {
+                double error = fabs(channel.smoothedDuty - trueDuty);
+                sim.errorSquares += error * error;
+                sim.errorSamples++;
+                if (error > sim.maxError) sim.maxError = error;
+            }
+
+            if (tank.psDuty > channel.settings.pemMaxValue) violation(ch, "PS duty above pemMaxValue");
+
+            // Operator refills an empty tank
+            if (!tank.refilling && channel.lowLevelLockout &&
+                plant.timeUs - sim.lowSinceUs >= REFILL_DELAY_S * 1000000ULL) {
+                tank.refilling = true;
+                sim.refills++;
+            } else if (tank.refilling && tank.level >= 1.0) {
+                tank.refilling = false;
+            }
+        }
+
+        if (plant.lastWatchdogToggleUs != 0 && plant.timeUs - plant.lastWatchdogToggleUs > watchdogLimitUs) {
+            violation(0, "watchdog toggle gap");
+            plant.lastWatchdogToggleUs = plant.timeUs;
+        }
+    }
+
+    double wallSeconds = (double)(clock() - wallStart) / CLOCKS_PER_SEC;
+
+    if (simLogFile != NULL) {
+        simLogFlush();
+        fclose(simLogFile);
+    }
+
+    printf("simulated %.1f h (%lu control steps at %d Hz, %d channel%s) in %.2f s\n",
+           hours, steps, CONTROL_RATE_HZ, channelCount, channelCount == 1 ? "" : "s", wallSeconds);
+    for (int ch = 0; ch < channelCount; ch++) {
+        SimChannel &sim = sims[ch];
+        if (channelCount > 1) printf("channel %d: ", ch);
+        printf("H2 cycles: %lu, PEM starts: %lu, H2 glitches: %lu, low-level trips: %lu, refills: %lu\n",
+               sim.h2Cycles, sim.pemStarts, sim.glitches, sim.lowLevelTrips, sim.refills);
+        if (channelCount > 1) printf("channel %d: ", ch);
+        printf("H2 drops: %lu, interrupt cutoffs: %lu\n", sim.h2Drops, sim.h2Cutoffs);
+        // Noise while H2 is off or still debouncing must not latch a cutoff
+        if (sim.h2Cutoffs > sim.h2Drops) violation(ch, "more H2 cutoffs than H2 drops");
+        if (channelCount > 1) printf("channel %d: ", ch);
+        printf("needle error (%s): rms %.2f duty, max %.2f duty\n",
+               filter == LEVEL_FILTER_KALMAN ? "kalman" : "ema",
+               sim.errorSamples ? sqrt(sim.errorSquares / sim.errorSamples) : 0.0, sim.maxError);
+    }
+    printf("first actuation: %.3f ms after start\n", metricsBootMilestoneUs(BOOT_FIRST_ACTUATION) / 1000.0);
+    const MetricStats &isr = metricsStage(METRIC_H2_ISR);
+    printf("max H2-off to PS=0 latency: %.3f ms (%lu interrupt cutoffs, h2_isr max %.1f us)\n",
+           maxH2LatencyUs / 1000.0, (unsigned long)isr.count,
+           isr.count ? isr.max / (double)halCyclesPerMicrosecond() : 0.0);
+    printf("max watchdog toggle gap: %.3f ms\n", plant.maxWatchdogGapUs / 1000.0);
+    printf("violations: %d\n", violations);
+
+    return violations ? 1 : 0;
+}
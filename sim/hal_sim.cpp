@@ -0,0 +1,194 @@
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include "hal.h"
+#include "plant.h"
+
+// Host implementation of hal.h backed by the simulated plant
+
+Plant plant;
+bool simVerbose = false;
+FILE *simLogFile = NULL;
+
+struct SimLogPage {
+  LogPageHeader header;
+  LogRecord records[LOG_RECORDS_PER_PAGE];
+};
+
+static SimLogPage simLogPage;
+static uint32_t simLogSequence = 1;
+
+// Same filtering as the ESP32 edge interrupt, in simulated time
+struct SimH2Input {
+  bool debounced;
+  uint64_t lastEdgeUs;
+  bool polledLevel;
+  bool cutoff;
+  uint32_t isrCycles;
+};
+
+static SimH2Input h2Inputs[MAX_CHANNELS];
+bool simH2Polling = false;
+
+#define SIM_H2_POLL_US 1  // Pin polling step of the simulated interrupt
+
+void halBegin() {
+    for (Tank &tank : plant.tanks) {
+        tank.psDuty = 0;
+        tank.gaugeDuty = 0;
+    }
+    for (SimH2Input &input : h2Inputs) {
+        input = SimH2Input();
+    }
+}
+
+unsigned long halMillis() {
+    return (unsigned long)(plant.timeUs / 1000);
+}
+
+unsigned long halMicros() {
+    return (unsigned long)plant.timeUs;
+}
+
+// Host profiling uses wall-clock nanoseconds as "cycles"
+uint32_t halCycles() {
+    return (uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+uint32_t halCyclesPerMicrosecond() {
+    return 1000;
+}
+
+void halSetGaugeDuty(int ch, int duty) {
+    plant.tanks[ch].gaugeDuty = duty;
+}
+
+void halSetPsDuty(int ch, int duty) {
+    plant.tanks[ch].psDuty = h2Inputs[ch].cutoff ? 0 : duty;
+}
+
+// Polling mode, as on the ESP32 when the edge interrupt is unavailable
+static void pollH2Edges(int ch) {
+    SimH2Input &input = h2Inputs[ch];
+    bool high = plant.h2Level(ch);
+    if (high == input.polledLevel) return;
+
+    uint64_t edgeUs = plant.timeUs;
+    input.polledLevel = high;
+    input.lastEdgeUs = edgeUs;
+    if (high || !input.debounced) return;
+
+    while (plant.timeUs - edgeUs <= (uint64_t)h2GlitchUs) {
+        plant.advance(SIM_H2_POLL_US);
+        if (plant.h2Level(ch)) {
+            input.polledLevel = true;
+            input.lastEdgeUs = plant.timeUs;
+            return;
+        }
+    }
+}
+
+bool halReadH2Signal(int ch) {
+    SimH2Input &input = h2Inputs[ch];
+    if (simH2Polling) pollH2Edges(ch);
+
+    bool high = plant.h2Level(ch);
+    uint64_t stableUs = plant.timeUs - input.lastEdgeUs;
+    if (high && !input.debounced && stableUs >= h2DebounceMs * 1000ULL) {
+        input.debounced = true;
+    } else if (!high && input.debounced && stableUs > (uint64_t)h2GlitchUs) {
+        input.debounced = false;
+    }
+    return input.debounced;
+}
+
+bool halTakeH2Cutoff(int ch, uint32_t *isrCycles) {
+    SimH2Input &input = h2Inputs[ch];
+    bool cutoff = input.cutoff;
+    *isrCycles = input.isrCycles;
+    input.cutoff = false;
+    return cutoff;
+}
+
+bool simH2Interrupt(int ch) {
+    if (simH2Polling) return false;  // Not installed
+
+    SimH2Input &input = h2Inputs[ch];
+    uint64_t edgeUs = plant.timeUs;
+
+    input.lastEdgeUs = edgeUs;
+    if (plant.h2Level(ch)) return false;
+
+    // The plant keeps running while the handler polls the pin
+    while (plant.timeUs - edgeUs < (uint64_t)h2GlitchUs) {
+        plant.advance(SIM_H2_POLL_US);
+        if (plant.h2Level(ch)) {
+            input.lastEdgeUs = plant.timeUs;
+            return false;
+        }
+    }
+
+    // Nothing to cut while H2 was still debouncing and the PS was off
+    if (!input.debounced && plant.tanks[ch].psDuty == 0) return false;
+
+    plant.tanks[ch].psDuty = 0;
+    uint32_t isrCycles = (uint32_t)((plant.timeUs - edgeUs) * halCyclesPerMicrosecond());
+    if (!input.cutoff || isrCycles > input.isrCycles) {
+        input.isrCycles = isrCycles;
+    }
+    input.cutoff = true;
+    input.debounced = false;
+    return true;
+}
+
+uint32_t halReadSensorMillivolts(int ch) {
+    return plant.sensorMillivolts(ch);
+}
+
+// The simulated sender is sampled from the first step
+bool halSensorReady(int /*ch*/) {
+    return true;
+}
+
+void halSetBacklight(int ch, bool on) {
+    plant.tanks[ch].backlight = on;
+}
+
+void halToggleWatchdog() {
+    plant.toggleWatchdog();
+}
+
+void halLog(const char *message) {
+    if (simVerbose) {
+        printf("[%10.3f s] %s\n", plant.timeUs / 1e6, message);
+    }
+}
+
+// halLog() prints right away on the host
+void halPrintLog() {
+}
+
+bool halLogRecord(const LogRecord &record) {
+    if (simLogFile == NULL) return true;
+
+    simLogPage.records[simLogPage.header.recordCount++] = record;
+    if (simLogPage.header.recordCount == LOG_RECORDS_PER_PAGE) {
+        simLogFlush();
+    }
+    return true;
+}
+
+// Append the page being filled; unlike the device the host file is not a ring
+void simLogFlush() {
+    if (simLogFile != NULL && simLogPage.header.recordCount > 0) {
+        simLogPage.header.magic = LOG_PAGE_MAGIC;
+        simLogPage.header.sequence = simLogSequence++;
+        simLogPage.header.version = LOG_FORMAT_VERSION;
+        simLogPage.header.recordSize = sizeof(LogRecord);
+        simLogPage.header.reserved = 0;
+        fwrite(&simLogPage, sizeof(simLogPage), 1, simLogFile);
+    }
+    memset(&simLogPage, 0xFF, sizeof(simLogPage));
+    simLogPage.header.recordCount = 0;
+}
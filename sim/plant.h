@@ -0,0 +1,127 @@
+#ifndef PLANT_H
+#define PLANT_H
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "control.h"
+
+// Simulated tanks, float senders, H2 boards and the outputs the controller
+// drives, one Tank per channel. hal_sim.cpp reads and writes this through
+// the HAL calls.
+struct Tank {
+  // Tank: 0.0 = empty, 1.0 = full
+  double level = 1.0;
+  double consumptionPerSec = 0.002;  // Level drawn per second at full PS duty
+  double fillPerSec = 0.02;          // Level added per second while refilling
+  bool refilling = false;
+
+  // Float sender and divider (sender on the low side, knownResistor on top)
+  double senderEmptyOhms = 240;
+  double senderFullOhms = 30;
+  double dividerOhms = 100;
+  double sloshAmplitude = 0.01;      // Peak slosh in level units while drawing
+  double sloshHz = 0.8;              // Frequency of the slow part of the slosh
+
+  bool h2Signal = false;             // H2 board output, without noise
+  uint64_t glitchStartUs = 0;        // The input reads inverted over [start, end)
+  uint64_t glitchEndUs = 0;
+
+  // Outputs
+  int gaugeDuty = 0;
+  int psDuty = 0;
+  bool backlight = false;
+
+  void advance(double dt) {
+    level -= consumptionPerSec * (psDuty / 255.0) * dt;
+    if (refilling) level += fillPerSec * dt;
+    if (level < 0) level = 0;
+    if (level > 1) level = 1;
+  }
+
+  // Slosh is half a slow wave, half sample-to-sample chop (chop in -1..1)
+  double senderOhms(double timeS, double chop) {
+    double slosh = 0;
+    if (psDuty > 0) {
+      double wave = sin(2 * M_PI * sloshHz * timeS);
+      slosh = sloshAmplitude * (0.5 * wave + 0.5 * chop);
+    }
+    double l = level + slosh;
+    if (l < 0) l = 0;
+    if (l > 1) l = 1;
+    return senderEmptyOhms + (senderFullOhms - senderEmptyOhms) * l;
+  }
+
+  double dividerMillivolts(double r) {
+    return 3300.0 * r / (r + dividerOhms);
+  }
+};
+
+struct Plant {
+  uint64_t timeUs = 0;
+  Tank tanks[MAX_CHANNELS];
+
+  double noiseMv = 5;                // Peak ADC noise after filtering
+
+  bool watchdogLevel = true;
+  uint64_t lastWatchdogToggleUs = 0;
+  uint64_t maxWatchdogGapUs = 0;
+
+  uint32_t rng = 12345;
+
+  double random() {
+    rng = rng * 1664525u + 1013904223u;
+    return (rng >> 8) / 16777216.0;
+  }
+
+  void advance(uint64_t dtUs) {
+    for (Tank &tank : tanks) tank.advance(dtUs / 1e6);
+    timeUs += dtUs;
+  }
+
+  uint32_t sensorMillivolts(int ch) {
+    Tank &tank = tanks[ch];
+    double r = tank.senderOhms(timeUs / 1e6, random() * 2 - 1);
+    double mv = tank.dividerMillivolts(r) + noiseMv * (random() * 2 - 1);
+    return mv < 0 ? 0 : (uint32_t)mv;
+  }
+
+  // H2 input as the pin sees it, coil-plug glitches included
+  bool h2Level(int ch) {
+    const Tank &tank = tanks[ch];
+    bool inGlitch = timeUs >= tank.glitchStartUs && timeUs < tank.glitchEndUs;
+    return tank.h2Signal != inGlitch;
+  }
+
+  // What the sender would read at the true level, without slosh or noise
+  uint32_t trueMillivolts(int ch) {
+    Tank &tank = tanks[ch];
+    double r = tank.senderEmptyOhms + (tank.senderFullOhms - tank.senderEmptyOhms) * tank.level;
+    return (uint32_t)tank.dividerMillivolts(r);
+  }
+
+  void toggleWatchdog() {
+    uint64_t gap = timeUs - lastWatchdogToggleUs;
+    if (lastWatchdogToggleUs != 0 && gap > maxWatchdogGapUs) maxWatchdogGapUs = gap;
+    lastWatchdogToggleUs = timeUs;
+    watchdogLevel = !watchdogLevel;
+  }
+};
+
+extern Plant plant;
+extern bool simVerbose;
+
+// When set, halLogRecord() appends log pages in the on-device format
+extern FILE *simLogFile;
+void simLogFlush();
+
+// Stands in for the H2 edge interrupt; call after a channel's H2 input
+// changed. A falling edge is polled in simulated time like on the device.
+// Returns true if it cut the power supply.
+bool simH2Interrupt(int ch);
+
+// Run as if the edge interrupt could not be installed: simH2Interrupt()
+// does nothing and halReadH2Signal() polls, like the ESP32 fallback
+extern bool simH2Polling;
+
+#endif
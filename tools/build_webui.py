@@ -0,0 +1,92 @@
+#!/usr/bin/env python3
+"""Build gaugecontrol/webui.h from webui/.
+
+Inlines style.css and app.js into index.html, minifies the result, gzips it
+and writes it as a PROGMEM byte array with an ETag derived from the content.
+Run it after editing anything in webui/ and commit the regenerated header:
+
+    python3 tools/build_webui.py
+"""
+
+import gzip
+import hashlib
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+SOURCE_DIR = os.path.join(ROOT, "webui")
+OUTPUT = os.path.join(ROOT, "gaugecontrol", "webui.h")
+
+
+def read(name):
+    with open(os.path.join(SOURCE_DIR, name), encoding="utf-8") as f:
+        return f.read()
+
+
+def minify_css(css):
+    css = re.sub(r"/\*.*?\*/", "", css, flags=re.S)
+    css = re.sub(r"\s+", " ", css)
+    css = re.sub(r"\s*([{};:,>])\s*", r"\1", css)
+    css = css.replace(";}", "}")
+    return css.strip()
+
+
+def minify_js(js):
+    # Conservative: drop comment-only lines and indentation; never touches
+    # code inside lines, so strings such as 'ws://' are safe
+    lines = []
+    for line in js.splitlines():
+        stripped = line.strip()
+        if not stripped or stripped.startswith("//"):
+            continue
+        lines.append(stripped)
+    return "\n".join(lines)
+
+
+def minify_html(html):
+    html = re.sub(r"<!--.*?-->", "", html, flags=re.S)
+    html = re.sub(r">\s+<", "><", html)
+    html = re.sub(r"\s+", " ", html)
+    return html.strip()
+
+
+def build_page():
+    html = read("index.html")
+    css = minify_css(read("style.css"))
+    js = minify_js(read("app.js"))
+
+    # Split out the script first so HTML whitespace rules never touch it
+    link = '<link rel="stylesheet" href="style.css">'
+    script = '<script src="app.js"></script>'
+    if link not in html or script not in html:
+        sys.exit("index.html must reference style.css and app.js")
+    html = html.replace(link, "<style>" + css + "</style>")
+    before, after = html.split(script)
+    return minify_html(before) + "<script>" + js + "</script>" + minify_html(after)
+
+
+def main():
+    page = build_page().encode("utf-8")
+    # mtime=0 keeps the output (and the ETag) identical for identical input
+    compressed = gzip.compress(page, compresslevel=9, mtime=0)
+    etag = hashlib.sha1(compressed).hexdigest()[:16]
+
+    rows = []
+    for i in range(0, len(compressed), 16):
+        rows.append("  " + ", ".join("0x%02x" % b for b in compressed[i:i + 16]) + ",")
+
+    with open(OUTPUT, "w", encoding="utf-8", newline="\n") as f:
+        f.write("// Generated by tools/build_webui.py from webui/ - do not edit.\n")
+        f.write("// %d bytes of HTML, %d bytes gzipped.\n\n" % (len(page), len(compressed)))
+        f.write("#define INDEX_HTML_ETAG \"\\\"%s\\\"\"\n\n" % etag)
+        f.write("const size_t index_html_gz_len = %d;\n" % len(compressed))
+        f.write("const uint8_t index_html_gz[] PROGMEM = {\n")
+        f.write("\n".join(rows))
+        f.write("\n};\n")
+
+    print("webui.h: %d bytes -> %d bytes gzipped, ETag %s" % (len(page), len(compressed), etag))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,101 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+#include "datalog.h"
+
+// Converts a data log download (http://<device-ip>/log) or a gaugesim --log
+// file to CSV. Pages are put back in sequence order, so it does not matter
+// where the ring wrapped; erased and torn pages are skipped. Records of all
+// channels are interleaved in time order; filter on the channel column.
+//
+//   g++ -std=c++17 -O2 -Igaugecontrol tools/logdecode.cpp -o logdecode
+//   ./logdecode gaugelog.bin > gaugelog.csv
+
+struct PageRef {
+    uint32_t sequence;
+    size_t offset;
+};
+
+static void printEvents(uint8_t events) {
+    static const struct {
+        uint8_t bit;
+        const char *name;
+    } names[] = {
+        {LOG_EVENT_PEM_START, "pem_start"},
+        {LOG_EVENT_PEM_RUNNING, "pem_running"},
+        {LOG_EVENT_PEM_STOP, "pem_stop"},
+        {LOG_EVENT_LOW_LEVEL_TRIP, "low_level_trip"},
+        {LOG_EVENT_BOOT, "boot"},
+        {LOG_EVENT_H2_CUTOFF, "h2_cutoff"},
+    };
+
+    bool first = true;
+    for (const auto &n : names) {
+        if (events & n.bit) {
+            printf("%s%s", first ? "" : "|", n.name);
+            first = false;
+        }
+    }
+}
+
+int main(int argc, char **argv) {
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s LOGFILE > out.csv\n", argv[0]);
+        return 2;
+    }
+
+    FILE *file = fopen(argv[1], "rb");
+    if (file == NULL) {
+        perror(argv[1]);
+        return 1;
+    }
+    std::vector<uint8_t> data;
+    uint8_t chunk[LOG_PAGE_SIZE];
+    size_t n;
+    while ((n = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+        data.insert(data.end(), chunk, chunk + n);
+    }
+    fclose(file);
+
+    std::vector<PageRef> pages;
+    for (size_t offset = 0; offset + LOG_PAGE_SIZE <= data.size(); offset += LOG_PAGE_SIZE) {
+        LogPageHeader header;
+        memcpy(&header, &data[offset], sizeof(header));
+        if (header.magic != LOG_PAGE_MAGIC || header.version != LOG_FORMAT_VERSION ||
+            header.recordSize != sizeof(LogRecord) || header.recordCount > LOG_RECORDS_PER_PAGE) {
+            continue;
+        }
+        pages.push_back({header.sequence, offset});
+    }
+    std::stable_sort(pages.begin(), pages.end(),
+                     [](const PageRef &a, const PageRef &b) { return a.sequence < b.sequence; });
+
+    printf("time_ms,channel,resistance_ohm,millivolts,target_duty,smoothed_duty,ps_duty,h2,pem_active,low_level,events\n");
+
+    unsigned long records = 0, gaps = 0;
+    for (size_t i = 0; i < pages.size(); i++) {
+        if (i > 0 && pages[i].sequence != pages[i - 1].sequence + 1) gaps++;
+
+        LogPageHeader header;
+        memcpy(&header, &data[pages[i].offset], sizeof(header));
+        for (int r = 0; r < header.recordCount; r++) {
+            LogRecord record;
+            memcpy(&record, &data[pages[i].offset + sizeof(header) + r * sizeof(LogRecord)], sizeof(record));
+            printf("%lu,%d,%.1f,%u,%d,%u,%u,%d,%d,%d,",
+                   (unsigned long)record.timeMs,
+                   (record.flags & LOG_FLAG_CHANNEL_MASK) >> LOG_FLAG_CHANNEL_SHIFT, record.resistance, record.millivolts,
+                   record.targetDuty, record.smoothedDuty, record.psDuty,
+                   (record.flags & LOG_FLAG_H2) ? 1 : 0,
+                   (record.flags & LOG_FLAG_PEM_ACTIVE) ? 1 : 0,
+                   (record.flags & LOG_FLAG_LOW_LEVEL) ? 1 : 0);
+            printEvents(record.events);
+            printf("\n");
+            records++;
+        }
+    }
+
+    fprintf(stderr, "%zu pages, %lu records, %lu sequence gaps\n", pages.size(), records, gaps);
+    return 0;
+}
@@ -0,0 +1,297 @@
+// Calibration curve being edited; sent with the rest of the configuration
+const CAL_MAX_POINTS = 8;
+const CAL_AVERAGE_SAMPLES = 20;  // Recent live samples averaged into a captured point
+let calibration = [];
+
+function renderCalibration() {
+    const table = document.getElementById('calTable');
+    table.innerHTML = '';
+    calibration.forEach((point, i) => {
+        const row = document.createElement('tr');
+        row.className = 'border-b';
+        row.innerHTML = '<td class="py-1">' + point.resistance.toFixed(1) + '</td><td class="py-1">' + point.duty +
+            '</td><td class="py-1 text-right"><button type="button" class="text-red-600 hover:underline">Remove</button></td>';
+        row.querySelector('button').addEventListener('click', () => {
+            calibration.splice(i, 1);
+            renderCalibration();
+        });
+        table.appendChild(row);
+    });
+    if (calibration.length < 2) {
+        const row = document.createElement('tr');
+        row.innerHTML = '<td class="py-1 text-gray-500" colspan="3">Linear (no curve)</td>';
+        table.appendChild(row);
+    }
+}
+
+document.getElementById('calCaptureBtn').addEventListener('click', function() {
+    const duty = parseInt(document.getElementById('calDuty').value);
+    const recent = history.resistance.slice(-CAL_AVERAGE_SAMPLES);
+    if (recent.length === 0) {
+        showStatus('No live reading yet', 'error');
+        return;
+    }
+    if (isNaN(duty) || duty < 0 || duty > 255) {
+        showStatus('Enter a duty between 0 and 255', 'error');
+        return;
+    }
+    if (calibration.length >= CAL_MAX_POINTS) {
+        showStatus('At most ' + CAL_MAX_POINTS + ' calibration points', 'error');
+        return;
+    }
+    const resistance = recent.reduce((sum, r) => sum + r, 0) / recent.length;
+    calibration.push({ resistance: Math.round(resistance * 10) / 10, duty: duty });
+    calibration.sort((a, b) => a.resistance - b.resistance);
+    renderCalibration();
+});
+
+document.getElementById('calClearBtn').addEventListener('click', function() {
+    calibration = [];
+    renderCalibration();
+});
+
+// Channel whose settings are shown and whose live frames are plotted.
+// Settings of every configured channel can be edited; only the channels
+// active since the last boot stream live data.
+let selectedChannel = 0;
+
+function fillConfig(config) {
+    const select = document.getElementById('channel');
+    select.innerHTML = '';
+    for (let ch = 0; ch < config.maxChannels; ch++) {
+        const option = document.createElement('option');
+        option.value = ch;
+        option.textContent = (ch + 1) + (ch < config.activeChannels ? '' : ' (inactive)');
+        select.appendChild(option);
+    }
+    select.value = config.channel;
+    document.getElementById('channelCount').value = config.channelCount;
+    document.getElementById('channelCount').max = config.maxChannels;
+    document.getElementById('maxResistance').value = config.maxResistance;
+    document.getElementById('minResistance').value = config.minResistance;
+    document.getElementById('knownResistor').value = config.knownResistor;
+    document.getElementById('minDuty').value = config.minDuty;
+    document.getElementById('maxDuty').value = config.maxDuty;
+    document.getElementById('blinkThreshold').value = config.blinkThreshold;
+    document.getElementById('lowLevelThreshold').value = config.lowLevelThreshold;
+    document.getElementById('blinkInterval').value = config.blinkInterval;
+    document.getElementById('numSamples').value = config.numSamples;
+    document.getElementById('stepDelay').value = config.stepDelay;
+    document.getElementById('wifiSSID').value = config.wifiSSID || '';
+    document.getElementById('wifiPassword').value = config.wifiPassword || '';
+    document.getElementById('pemMaxValue').value = config.pemMaxValue;
+    document.getElementById('pemStepSize').value = config.pemStepSize;
+    document.getElementById('streamRate').value = config.streamRate;
+    document.getElementById('h2DebounceMs').value = config.h2DebounceMs;
+    document.getElementById('h2GlitchUs').value = config.h2GlitchUs;
+    document.getElementById('levelFilter').value = config.levelFilter;
+    document.getElementById('levelNoise').value = config.levelNoise;
+    document.getElementById('rateNoise').value = config.rateNoise;
+    document.getElementById('lowLevelLookahead').value = config.lowLevelLookahead;
+    calibration = config.calibration || [];
+    renderCalibration();
+}
+
+// Get the configuration of the selected channel
+function loadConfig() {
+    fetch('/config?channel=' + selectedChannel)
+        .then(response => response.json())
+        .then(fillConfig)
+        .catch(error => {
+            console.error('Error fetching configuration:', error);
+            showStatus('Failed to load configuration', 'error');
+        });
+}
+
+document.getElementById('channel').addEventListener('change', function() {
+    selectedChannel = parseInt(this.value);
+    for (const key in history) history[key] = [];
+    loadConfig();
+});
+
+// Save configuration
+document.getElementById('saveBtn').addEventListener('click', function() {
+    const config = {
+        channelCount: parseInt(document.getElementById('channelCount').value),
+        maxResistance: parseInt(document.getElementById('maxResistance').value),
+        minResistance: parseInt(document.getElementById('minResistance').value),
+        knownResistor: parseInt(document.getElementById('knownResistor').value),
+        minDuty: parseInt(document.getElementById('minDuty').value),
+        maxDuty: parseInt(document.getElementById('maxDuty').value),
+        blinkThreshold: parseInt(document.getElementById('blinkThreshold').value),
+        lowLevelThreshold: parseInt(document.getElementById('lowLevelThreshold').value),
+        blinkInterval: parseInt(document.getElementById('blinkInterval').value),
+        numSamples: parseInt(document.getElementById('numSamples').value),
+        stepDelay: parseInt(document.getElementById('stepDelay').value),
+        wifiSSID: document.getElementById('wifiSSID').value,
+        wifiPassword: document.getElementById('wifiPassword').value,
+        pemMaxValue: parseInt(document.getElementById('pemMaxValue').value),
+        pemStepSize: parseInt(document.getElementById('pemStepSize').value),
+        streamRate: parseInt(document.getElementById('streamRate').value),
+        h2DebounceMs: parseInt(document.getElementById('h2DebounceMs').value),
+        h2GlitchUs: parseInt(document.getElementById('h2GlitchUs').value),
+        levelFilter: parseInt(document.getElementById('levelFilter').value),
+        levelNoise: parseFloat(document.getElementById('levelNoise').value),
+        rateNoise: parseFloat(document.getElementById('rateNoise').value),
+        lowLevelLookahead: parseInt(document.getElementById('lowLevelLookahead').value),
+        calibration: calibration
+    };
+
+    fetch('/config?channel=' + selectedChannel, {
+        method: 'POST',
+        headers: {
+            'Content-Type': 'application/json',
+        },
+        body: JSON.stringify(config),
+    })
+    .then(response => response.json())
+    .then(data => {
+        showStatus(data.message || 'Configuration saved successfully!', data.status === 'error' ? 'error' : 'success');
+    })
+    .catch(error => {
+        console.error('Error saving configuration:', error);
+        showStatus('Failed to save configuration', 'error');
+    });
+});
+
+// Reset to defaults
+document.getElementById('resetBtn').addEventListener('click', function() {
+    if (confirm('Are you sure you want to reset to default settings?')) {
+        fetch('/reset?channel=' + selectedChannel, { method: 'POST' })
+            .then(response => response.json())
+            .then(config => {
+                fillConfig(config);
+                showStatus('Reset to default values', 'success');
+            })
+            .catch(error => {
+                console.error('Error resetting configuration:', error);
+                showStatus('Failed to reset configuration', 'error');
+            });
+    }
+});
+
+// Live data is pushed over a WebSocket as 24-byte little-endian frames:
+// type u8, flags u8, targetDuty u16, smoothedDuty u16, rampValue u16, timeMs u32, resistance f32,
+// levelRate f32 (duty/s), timeToEmpty f32 (s, -1 when not draining). Each active
+// channel sends its own frames, with the channel in the high nibble of flags.
+const HISTORY_SIZE = 600;
+const history = { resistance: [], targetDuty: [], smoothedDuty: [], ramp: [] };
+let chartPending = false;
+
+function connectStream() {
+    const ws = new WebSocket('ws://' + location.host + '/ws');
+    ws.binaryType = 'arraybuffer';
+
+    ws.onopen = () => {
+        document.getElementById('streamStatus').textContent = 'Live';
+    };
+    ws.onclose = () => {
+        document.getElementById('streamStatus').textContent = 'Disconnected - retrying...';
+        setTimeout(connectStream, 2000);
+    };
+    ws.onmessage = (event) => {
+        const view = new DataView(event.data);
+        if (view.byteLength < 24 || view.getUint8(0) !== 1) return;
+        const flags = view.getUint8(1);
+        if ((flags >> 4) !== selectedChannel) return;
+        updateLive({
+            pemRunning: (flags & 1) !== 0,
+            targetDuty: view.getUint16(2, true),
+            smoothedDuty: view.getUint16(4, true),
+            ramp: view.getUint16(6, true),
+            resistance: view.getFloat32(12, true),
+            levelRate: view.getFloat32(16, true),
+            timeToEmpty: view.getFloat32(20, true)
+        });
+    };
+}
+
+function updateLive(data) {
+    document.getElementById('liveResistance').textContent = data.resistance.toFixed(1) + ' Ω';
+    document.getElementById('liveTargetDuty').textContent = data.targetDuty;
+    document.getElementById('liveSmoothedDuty').textContent = data.smoothedDuty;
+    document.getElementById('liveRamp').textContent = data.ramp;
+    document.getElementById('calLiveResistance').textContent = data.resistance.toFixed(1) + ' Ω';
+    document.getElementById('livePemStatus').textContent = data.pemRunning ? 'Running' : 'Stopped';
+    document.getElementById('liveLevelRate').textContent = (data.levelRate * 60).toFixed(1) + ' /min';
+    document.getElementById('liveTimeToEmpty').textContent = formatDuration(data.timeToEmpty);
+    
+    // Add highlight class based on status
+    document.getElementById('livePemStatus').className = 
+        data.pemRunning ? 'font-bold text-lg text-green-600' : 'font-bold text-lg text-red-600';
+
+    for (const key in history) {
+        history[key].push(data[key]);
+        if (history[key].length > HISTORY_SIZE) history[key].shift();
+    }
+
+    // Redraw at most once per animation frame however fast frames arrive
+    if (!chartPending) {
+        chartPending = true;
+        requestAnimationFrame(drawChart);
+    }
+}
+
+// Seconds as h:mm:ss or m:ss; negative means not draining
+function formatDuration(seconds) {
+    if (seconds < 0) return '--';
+    const s = Math.round(seconds);
+    const pad = (n) => String(n).padStart(2, '0');
+    if (s < 3600) return Math.floor(s / 60) + ':' + pad(s % 60);
+    return Math.floor(s / 3600) + ':' + pad(Math.floor(s / 60) % 60) + ':' + pad(s % 60);
+}
+
+function drawChart() {
+    chartPending = false;
+    const canvas = document.getElementById('liveChart');
+    const ctx = canvas.getContext('2d');
+    canvas.width = canvas.clientWidth;
+    const w = canvas.width, h = canvas.height;
+    ctx.clearRect(0, 0, w, h);
+
+    ctx.strokeStyle = '#e5e7eb';
+    for (let i = 1; i < 4; i++) {
+        ctx.beginPath();
+        ctx.moveTo(0, h * i / 4);
+        ctx.lineTo(w, h * i / 4);
+        ctx.stroke();
+    }
+
+    // Duty values share a 0-255 scale; resistance is scaled to the configured empty value
+    const maxOhms = (parseInt(document.getElementById('maxResistance').value) || 250) * 1.2;
+    const plot = (values, max, color) => {
+        ctx.strokeStyle = color;
+        ctx.beginPath();
+        values.forEach((v, i) => {
+            const x = w * i / (HISTORY_SIZE - 1);
+            const y = h - h * Math.min(v / max, 1);
+            if (i === 0) ctx.moveTo(x, y); else ctx.lineTo(x, y);
+        });
+        ctx.stroke();
+    };
+    plot(history.resistance, maxOhms, '#2563eb');
+    plot(history.targetDuty, 255, '#9ca3af');
+    plot(history.smoothedDuty, 255, '#16a34a');
+    plot(history.ramp, 255, '#dc2626');
+}
+
+loadConfig();
+connectStream();
+
+function showStatus(message, type) {
+    const statusEl = document.getElementById('statusMessage');
+    statusEl.textContent = message;
+    statusEl.className = 'mt-4 text-center p-2 rounded';
+    
+    if (type === 'error') {
+        statusEl.classList.add('bg-red-100', 'text-red-700');
+    } else {
+        statusEl.classList.add('bg-green-100', 'text-green-700');
+    }
+    
+    statusEl.classList.remove('hidden');
+    
+    setTimeout(() => {
+        statusEl.classList.add('hidden');
+    }, 3000);
+}